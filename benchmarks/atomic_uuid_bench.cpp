@@ -0,0 +1,71 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <mutex>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/atomic_uuid.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+// Read-mostly: thread 0 swaps the value once per `k_write_interval` operations, and the
+// rest only read.
+constexpr int k_write_interval = 1024;
+
+class mutex_uuid {
+public:
+    explicit mutex_uuid(const uuidxx::uuid& id)
+        : id_(id) {}
+
+    uuidxx::uuid load() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return id_;
+    }
+
+    void store(const uuidxx::uuid& id) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        id_ = id;
+    }
+
+private:
+    mutable std::mutex mtx_;
+    uuidxx::uuid id_;
+};
+
+template<typename T>
+void run_read_mostly(benchmark::State& state, T& value) {
+    const auto a = uuidxx::make_v4();
+    int i = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && ++i == k_write_interval) {
+            value.store(a);
+            i = 0;
+        } else {
+            benchmark::DoNotOptimize(value.load());
+        }
+    }
+}
+
+void BM_atomic_uuid(benchmark::State& state) {
+    static uuidxx::atomic_uuid value(uuidxx::k_nil);
+    run_read_mostly(state, value);
+}
+
+void BM_atomic_uuid_seqlock(benchmark::State& state) {
+    static uuidxx::atomic_uuid value(uuidxx::k_nil, uuidxx::details::use_seqlock);
+    run_read_mostly(state, value);
+}
+
+void BM_mutex_uuid(benchmark::State& state) {
+    static mutex_uuid value(uuidxx::k_nil);
+    run_read_mostly(state, value);
+}
+
+} // namespace
+
+BENCHMARK(BM_atomic_uuid)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_atomic_uuid_seqlock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_mutex_uuid)->ThreadRange(1, 8)->UseRealTime();
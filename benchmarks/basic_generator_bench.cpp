@@ -0,0 +1,56 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/basic_generator.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+constexpr uuidxx::node_id k_bench_node{std::byte{0x02}, std::byte{0x00}, std::byte{0x5e},
+                                       std::byte{0x10}, std::byte{0x20}, std::byte{0x30}};
+
+UUIDXX_CONSTINIT thread_local uuidxx::local_generator t_gen(uuidxx::local_clock{},
+                                                            uuidxx::local_rand{},
+                                                            uuidxx::fixed_node(k_bench_node));
+
+void BM_make_v1(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuidxx::make_v1());
+    }
+}
+
+void BM_default_generator_v1(benchmark::State& state) {
+    uuidxx::default_generator gen;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gen.make_v1());
+    }
+}
+
+void BM_local_generator_v1(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t_gen.make_v1());
+    }
+}
+
+void BM_make_v4(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuidxx::make_v4());
+    }
+}
+
+void BM_local_generator_v4(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t_gen.make_v4());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_make_v1)->ThreadRange(1, 4);
+BENCHMARK(BM_default_generator_v1)->ThreadRange(1, 4);
+BENCHMARK(BM_local_generator_v1)->ThreadRange(1, 4);
+BENCHMARK(BM_make_v4)->ThreadRange(1, 4);
+BENCHMARK(BM_local_generator_v4)->ThreadRange(1, 4);
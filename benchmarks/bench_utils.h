@@ -0,0 +1,114 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_BENCHMARKS_BENCH_UTILS_H_
+#define UUIDXX_BENCHMARKS_BENCH_UTILS_H_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuidxx.h"
+
+namespace uuidxx {
+namespace bench {
+
+// Records latency of each operation and reports p50/p99/p999 as counters in ns.
+// In multi-threaded runs, samples of all threads are merged and reported by thread 0, as
+// google benchmark sums counters of threads up.
+class latency_recorder {
+public:
+    explicit latency_recorder(std::size_t reserved = 1 << 20) {
+        samples_.reserve(reserved);
+    }
+
+    template<typename F>
+    void measure(F&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        samples_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    // Waits for all threads of the run in thread 0, thus all of them must call it.
+    void report(benchmark::State& state) {
+        auto& merged = merged_samples::instance();
+        std::unique_lock lock(merged.mtx);
+        merged.samples.insert(merged.samples.end(), samples_.begin(), samples_.end());
+        ++merged.arrived;
+        if (state.thread_index() != 0) {
+            merged.cv.notify_all();
+            return;
+        }
+
+        merged.cv.wait(lock, [&] { return merged.arrived == state.threads(); });
+        auto samples = std::move(merged.samples);
+        merged.samples.clear();
+        merged.arrived = 0;
+        lock.unlock();
+
+        if (samples.empty()) {
+            return;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        state.counters["p50_ns"] = static_cast<double>(percentile(samples, 0.5));
+        state.counters["p99_ns"] = static_cast<double>(percentile(samples, 0.99));
+        state.counters["p999_ns"] = static_cast<double>(percentile(samples, 0.999));
+        state.counters["max_ns"] = static_cast<double>(samples.back());
+    }
+
+private:
+    // Only one benchmark runs at a time.
+    struct merged_samples {
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::vector<int64_t> samples;
+        int arrived{0};
+
+        static merged_samples& instance() {
+            static merged_samples merged;
+            return merged;
+        }
+    };
+
+    static int64_t percentile(const std::vector<int64_t>& sorted, double p) {
+        auto idx = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+        return sorted[idx];
+    }
+
+private:
+    std::vector<int64_t> samples_;
+};
+
+// Random ids, or time-based ones if `time_based`.
+inline std::vector<uuid> make_ids(std::size_t count, bool time_based = false) {
+    std::vector<uuid> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.push_back(time_based ? make_v1() : make_v4());
+    }
+    return ids;
+}
+
+// Half of probes are present, spread over `ids`; the others are absent.
+inline std::vector<uuid> make_probes(const std::vector<uuid>& ids, std::size_t count) {
+    std::vector<uuid> probes;
+    probes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        probes.push_back(i % 2 == 0 ? ids[(i * 7919) % ids.size()] : make_v4());
+    }
+    return probes;
+}
+
+} // namespace bench
+} // namespace uuidxx
+
+#endif // UUIDXX_BENCHMARKS_BENCH_UTILS_H_
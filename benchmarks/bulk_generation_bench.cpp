@@ -0,0 +1,90 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/bulk_generation.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+constexpr std::size_t k_count = 1 << 20;
+
+const std::vector<std::string>& name_storage() {
+    static auto names = [] {
+        std::vector<std::string> v;
+        for (std::size_t i = 0; i < k_count; ++i) {
+            v.push_back("https://example.com/users/" + std::to_string(i));
+        }
+        return v;
+    }();
+    return names;
+}
+
+void BM_make_v5_loop(benchmark::State& state) {
+    const auto& names = name_storage();
+    std::vector<uuidxx::uuid> out(k_count, uuidxx::k_nil);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_count; ++i) {
+            out[i] = uuidxx::make_v5(uuidxx::k_namespace_url, names[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_make_v5_bulk(benchmark::State& state) {
+    const auto& storage = name_storage();
+    std::vector<std::string_view> names(storage.begin(), storage.end());
+    std::vector<uuidxx::uuid> out(k_count, uuidxx::k_nil);
+    uuidxx::bulk_options opts;
+    opts.threads = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        uuidxx::make_v5_bulk(uuidxx::k_namespace_url, names.data(), k_count, out.data(), opts);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_make_v4_loop(benchmark::State& state) {
+    std::vector<uuidxx::uuid> out(k_count, uuidxx::k_nil);
+    for (auto _ : state) {
+        for (auto& id : out) {
+            id = uuidxx::make_v4();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_make_v4_bulk(benchmark::State& state) {
+    std::vector<uuidxx::uuid> out(k_count, uuidxx::k_nil);
+    uuidxx::bulk_options opts;
+    opts.threads = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        uuidxx::make_v4_bulk(out.data(), k_count, opts);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void thread_counts(benchmark::internal::Benchmark* bench) {
+    const auto cores = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+    for (int n = 1; n < cores; n *= 2) {
+        bench->Arg(n);
+    }
+    bench->Arg(cores);
+}
+
+} // namespace
+
+BENCHMARK(BM_make_v5_loop)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_make_v5_bulk)->Apply(thread_counts)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_make_v4_loop)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_make_v4_bulk)->Apply(thread_counts)->Unit(benchmark::kMillisecond)->UseRealTime();
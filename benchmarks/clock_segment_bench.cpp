@@ -0,0 +1,35 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/clock_segment.h"
+#include "uuidxx/clock_sequence.h"
+
+namespace {
+
+void BM_clock_sequence_read(benchmark::State& state) {
+    auto& clock = uuidxx::clock_sequence::instance();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(clock.read());
+    }
+}
+
+void BM_clock_segment_read(benchmark::State& state) {
+    static uuidxx::details::clock_segment seg;
+    static const bool opened = seg.open_anonymous(0);
+    if (!opened) {
+        state.SkipWithError("cannot map shared memory");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(seg.read(uuidxx::clock_sequence::get_timestamp_since_epoch()));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_clock_sequence_read)->ThreadRange(1, 8);
+BENCHMARK(BM_clock_segment_read)->ThreadRange(1, 8);
@@ -0,0 +1,59 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/sorted_uuid_index.h"
+#include "uuidxx/uuidxx.h"
+
+#include "bench_utils.h"
+
+namespace {
+
+using uuidxx::bench::make_ids;
+using uuidxx::bench::make_probes;
+
+void BM_std_binary_search(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)), false);
+    auto probes = make_probes(ids, 4096);
+    std::sort(ids.begin(), ids.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                std::binary_search(ids.begin(), ids.end(), probes[i++ % probes.size()]));
+    }
+}
+
+void BM_index_contains(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+    auto probes = make_probes(ids, 4096);
+    uuidxx::sorted_uuid_index index(ids);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.contains(probes[i++ % probes.size()]));
+    }
+}
+
+void BM_index_resolve_prefix(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)), false);
+    uuidxx::sorted_uuid_index index(ids);
+    std::vector<std::string> prefixes;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        prefixes.push_back(ids[(i * 7919) % ids.size()].to_string().substr(0, 12));
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.resolve(prefixes[i++ % prefixes.size()]));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_std_binary_search)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+// Second argument: 0 for v4, 1 for v1.
+BENCHMARK(BM_index_contains)->ArgsProduct({{1 << 10, 1 << 16, 1 << 22}, {0, 1}});
+BENCHMARK(BM_index_resolve_prefix)->Arg(1 << 16)->Arg(1 << 22);
@@ -0,0 +1,84 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_column.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+template<typename Gen>
+std::vector<uuidxx::uuid> sorted_ids(std::size_t count, Gen gen) {
+    std::vector<uuidxx::uuid> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.push_back(gen());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+const std::vector<uuidxx::uuid>& v1_ids() {
+    static auto ids = sorted_ids(1 << 20, [] { return uuidxx::make_v1(); });
+    return ids;
+}
+
+const std::vector<uuidxx::uuid>& v4_ids() {
+    static auto ids = sorted_ids(1 << 20, [] { return uuidxx::make_v4(); });
+    return ids;
+}
+
+void report_ratio(benchmark::State& state, const uuidxx::uuid_column& col) {
+    state.counters["bytes_per_id"] =
+            static_cast<double>(col.memory_usage()) / static_cast<double>(col.size());
+    state.counters["ratio"] = static_cast<double>(col.size() * sizeof(uuidxx::uuid)) /
+                              static_cast<double>(col.memory_usage());
+}
+
+template<const std::vector<uuidxx::uuid>& (*Ids)()>
+void BM_column_decode(benchmark::State& state) {
+    uuidxx::uuid_column col(Ids());
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (auto id : col) {
+            sum += id.raw_data()[1];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+    report_ratio(state, col);
+}
+
+template<const std::vector<uuidxx::uuid>& (*Ids)()>
+void BM_column_contains(benchmark::State& state) {
+    const auto& ids = Ids();
+    uuidxx::uuid_column col(ids);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(col.contains(ids[i]));
+        i = (i + 7919) % ids.size();
+    }
+    report_ratio(state, col);
+}
+
+void BM_sorted_vector_contains(benchmark::State& state) {
+    const auto& ids = v1_ids();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::binary_search(ids.begin(), ids.end(), ids[i]));
+        i = (i + 7919) % ids.size();
+    }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_column_decode, v1_ids);
+BENCHMARK_TEMPLATE(BM_column_decode, v4_ids);
+BENCHMARK_TEMPLATE(BM_column_contains, v1_ids);
+BENCHMARK_TEMPLATE(BM_column_contains, v4_ids);
+BENCHMARK(BM_sorted_vector_contains);
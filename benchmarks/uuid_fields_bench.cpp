@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_fields.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+const std::vector<uuidxx::uuid>& v1_ids() {
+    static auto ids = [] {
+        std::vector<uuidxx::uuid> v;
+        for (int i = 0; i < (1 << 16); ++i) {
+            v.push_back(uuidxx::make_v1());
+        }
+        return v;
+    }();
+    return ids;
+}
+
+void BM_timestamp_via_string(benchmark::State& state) {
+    const auto& ids = v1_ids();
+    for (auto _ : state) {
+        for (const auto& id : ids) {
+            auto str = id.to_string();
+            auto ts = std::stoull(str.substr(15, 3) + str.substr(9, 4) + str.substr(0, 8),
+                                  nullptr, 16);
+            benchmark::DoNotOptimize(ts);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_timestamp_accessor(benchmark::State& state) {
+    const auto& ids = v1_ids();
+    for (auto _ : state) {
+        for (const auto& id : ids) {
+            benchmark::DoNotOptimize(id.timestamp());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_extract_timestamps(benchmark::State& state) {
+    const auto& ids = v1_ids();
+    std::vector<uuidxx::uuid_timestamp> out(ids.size());
+    for (auto _ : state) {
+        uuidxx::extract_timestamps(ids.data(), ids.size(), out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_timestamp_via_string);
+BENCHMARK(BM_timestamp_accessor);
+BENCHMARK(BM_extract_timestamps);
@@ -0,0 +1,81 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_file.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+constexpr std::size_t k_count = 1 << 22;
+
+const std::vector<uuidxx::uuid>& sample_ids() {
+    static auto ids = [] {
+        std::vector<uuidxx::uuid> v;
+        v.reserve(k_count);
+        for (std::size_t i = 0; i < k_count; ++i) {
+            v.push_back(uuidxx::make_v4());
+        }
+        return v;
+    }();
+    return ids;
+}
+
+std::string sample_file(std::size_t fence_stride) {
+    auto path = (std::filesystem::temp_directory_path() /
+                 ("uuidxx_uuid_file_bench_" + std::to_string(fence_stride)))
+                        .string();
+    const auto& ids = sample_ids();
+    uuidxx::write_uuid_file(path, ids.data(), ids.size(), fence_stride);
+    return path;
+}
+
+void BM_reader_open(benchmark::State& state) {
+    auto path = sample_file(uuidxx::uuid_file_writer::k_default_fence_stride);
+    for (auto _ : state) {
+        uuidxx::uuid_file_reader reader;
+        benchmark::DoNotOptimize(reader.open(path));
+    }
+    std::filesystem::remove(path);
+}
+
+void BM_parse_text(benchmark::State& state) {
+    std::vector<std::string> lines;
+    for (const auto& id : sample_ids()) {
+        lines.push_back(id.to_string());
+    }
+    for (auto _ : state) {
+        std::vector<uuidxx::uuid> ids;
+        ids.reserve(lines.size());
+        for (const auto& line : lines) {
+            ids.push_back(uuidxx::make_from(line));
+        }
+        benchmark::DoNotOptimize(ids.data());
+    }
+}
+
+// Argument: fence stride, 0 for none.
+void BM_reader_contains(benchmark::State& state) {
+    auto path = sample_file(static_cast<std::size_t>(state.range(0)));
+    uuidxx::uuid_file_reader reader;
+    reader.open(path);
+    const auto& ids = sample_ids();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.contains(ids[(i++ * 7919) % ids.size()]));
+    }
+    reader.close();
+    std::filesystem::remove(path);
+}
+
+} // namespace
+
+BENCHMARK(BM_reader_open);
+BENCHMARK(BM_parse_text)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_reader_contains)->Arg(0)->Arg(64)->Arg(1024);
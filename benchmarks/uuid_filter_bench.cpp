@@ -0,0 +1,119 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_filter.h"
+#include "uuidxx/uuidxx.h"
+
+#include "bench_utils.h"
+
+namespace {
+
+using uuidxx::bench::make_ids;
+
+// A generic Bloom filter re-hashing every key, as a baseline.
+class generic_bloom {
+public:
+    explicit generic_bloom(std::size_t count)
+        : bits_(count * 12 / 64 + 1) {}
+
+    void insert(const uuidxx::uuid& id) {
+        auto h = hash(id);
+        for (int i = 0; i < k_hashes; ++i) {
+            auto bit = (h + static_cast<uint64_t>(i) * (h >> 32 | 1)) % (bits_.size() * 64);
+            bits_[bit / 64] |= UINT64_C(1) << (bit % 64);
+        }
+    }
+
+    bool maybe_contains(const uuidxx::uuid& id) const {
+        auto h = hash(id);
+        for (int i = 0; i < k_hashes; ++i) {
+            auto bit = (h + static_cast<uint64_t>(i) * (h >> 32 | 1)) % (bits_.size() * 64);
+            if (!(bits_[bit / 64] & (UINT64_C(1) << (bit % 64)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static uint64_t hash(const uuidxx::uuid& id) {
+        std::string_view bytes(reinterpret_cast<const char*>(id.raw_data().data()),
+                               sizeof(uuidxx::uuid::data));
+        return std::hash<std::string_view>{}(bytes);
+    }
+
+    static constexpr int k_hashes = 8;
+    std::vector<uint64_t> bits_;
+};
+
+void BM_filter_insert_many(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto ids = make_ids(count);
+    uuidxx::uuid_filter filter(count);
+    for (auto _ : state) {
+        filter.insert_many(ids.data(), ids.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_filter_maybe_contains_many(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto ids = make_ids(count);
+    auto probes = make_ids(count);
+    uuidxx::uuid_filter filter(count);
+    filter.insert_many(ids.data(), ids.size());
+    std::unique_ptr<bool[]> results(new bool[count]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(filter.maybe_contains_many(probes.data(), count, results.get()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_filter_maybe_contains(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto ids = make_ids(count);
+    auto probes = make_ids(count);
+    uuidxx::uuid_filter filter(count);
+    filter.insert_many(ids.data(), ids.size());
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const auto& id : probes) {
+            hits += filter.maybe_contains(id);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_generic_bloom_maybe_contains(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto ids = make_ids(count);
+    auto probes = make_ids(count);
+    generic_bloom filter(count);
+    for (const auto& id : ids) {
+        filter.insert(id);
+    }
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const auto& id : probes) {
+            hits += filter.maybe_contains(id);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+} // namespace
+
+BENCHMARK(BM_filter_insert_many)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_filter_maybe_contains_many)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_filter_maybe_contains)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_generic_bloom_maybe_contains)->Arg(1 << 16)->Arg(1 << 22);
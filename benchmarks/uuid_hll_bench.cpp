@@ -0,0 +1,82 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_hll.h"
+#include "uuidxx/uuidxx.h"
+
+#include "bench_utils.h"
+
+namespace {
+
+using uuidxx::bench::make_ids;
+
+constexpr std::size_t k_count = 1 << 20;
+
+const std::vector<uuidxx::uuid>& sample_ids(bool time_based) {
+    static const auto v1_ids = make_ids(k_count, true);
+    static const auto v4_ids = make_ids(k_count, false);
+    return time_based ? v1_ids : v4_ids;
+}
+
+// Argument: 0 for v4, 1 for v1.
+void BM_hll_add_many(benchmark::State& state) {
+    const auto& ids = sample_ids(state.range(0) != 0);
+    uuidxx::uuid_hll hll;
+    for (auto _ : state) {
+        hll.add_many(ids.data(), ids.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_unordered_set_insert(benchmark::State& state) {
+    const auto& ids = sample_ids(false);
+    for (auto _ : state) {
+        std::unordered_set<uuidxx::uuid> set(ids.begin(), ids.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+// Argument: precision.
+void BM_hll_merge(benchmark::State& state) {
+    const auto& ids = sample_ids(false);
+    uuidxx::uuid_hll dst(static_cast<int>(state.range(0)));
+    uuidxx::uuid_hll src(static_cast<int>(state.range(0)));
+    src.add_many(ids.data(), ids.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dst.merge(src));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.memory_usage()));
+}
+
+void BM_hll_estimate(benchmark::State& state) {
+    const auto& ids = sample_ids(false);
+    uuidxx::uuid_hll hll;
+    hll.add_many(ids.data(), ids.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hll.estimate());
+    }
+}
+
+void BM_hll_serialize(benchmark::State& state) {
+    const auto& ids = sample_ids(false);
+    uuidxx::uuid_hll hll;
+    hll.add_many(ids.data(), ids.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hll.serialize());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_hll_add_many)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_unordered_set_insert)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_hll_merge)->Arg(10)->Arg(14)->Arg(18);
+BENCHMARK(BM_hll_estimate);
+BENCHMARK(BM_hll_serialize);
@@ -0,0 +1,89 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_interner.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+// A column with every id repeated 4 times on average.
+const std::vector<uuidxx::uuid>& column() {
+    static auto ids = [] {
+        std::vector<uuidxx::uuid> distinct;
+        for (int i = 0; i < (1 << 18); ++i) {
+            distinct.push_back(uuidxx::make_v4());
+        }
+
+        std::vector<uuidxx::uuid> v;
+        uint64_t x = 42;
+        for (int i = 0; i < (1 << 20); ++i) {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+            v.push_back(distinct[(x >> 33) % distinct.size()]);
+        }
+        return v;
+    }();
+    return ids;
+}
+
+void BM_unordered_map_intern(benchmark::State& state) {
+    const auto& ids = column();
+    std::vector<uint32_t> keys(ids.size());
+    for (auto _ : state) {
+        std::unordered_map<uuidxx::uuid, uint32_t> map;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            keys[i] = map.try_emplace(ids[i], static_cast<uint32_t>(map.size())).first->second;
+        }
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_interner_intern(benchmark::State& state) {
+    const auto& ids = column();
+    std::vector<uint32_t> keys(ids.size());
+    for (auto _ : state) {
+        uuidxx::uuid_interner interner;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            keys[i] = interner.intern(ids[i]);
+        }
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_interner_intern_many(benchmark::State& state) {
+    const auto& ids = column();
+    std::vector<uint32_t> keys(ids.size());
+    for (auto _ : state) {
+        uuidxx::uuid_interner interner;
+        interner.intern_many(ids.data(), ids.size(), keys.data());
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+void BM_interner_lookup_many(benchmark::State& state) {
+    const auto& ids = column();
+    uuidxx::uuid_interner interner;
+    std::vector<uint32_t> keys(ids.size());
+    interner.intern_many(ids.data(), ids.size(), keys.data());
+    std::vector<uuidxx::uuid> out(ids.size(), uuidxx::k_nil);
+    for (auto _ : state) {
+        interner.lookup_many(keys.data(), keys.size(), out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ids.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_unordered_map_intern)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_interner_intern)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_interner_intern_many)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_interner_lookup_many)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/bulk_generation.h"
+#include "uuidxx/uuid_partition.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+// 256 MiB each way, far beyond the LLC; 100M ids behave the same, only slower to set up.
+constexpr std::size_t k_count = 1 << 24;
+
+const std::vector<uuidxx::uuid>& sample_ids() {
+    static const auto ids = [] {
+        std::vector<uuidxx::uuid> v(k_count, uuidxx::k_nil);
+        uuidxx::make_v4_bulk(v.data(), v.size());
+        return v;
+    }();
+    return ids;
+}
+
+std::vector<uuidxx::uuid>& output() {
+    static std::vector<uuidxx::uuid> out(k_count, uuidxx::k_nil);
+    return out;
+}
+
+void set_counters(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+    // Input is read twice, and output written once.
+    state.SetBytesProcessed(
+            static_cast<int64_t>(state.iterations() * k_count * sizeof(uuidxx::uuid) * 3));
+}
+
+// Counts, then stores each id straight to its slot, as `hash(uuid) % N` does.
+void BM_direct_scatter(benchmark::State& state) {
+    const auto& ids = sample_ids();
+    auto& out = output();
+    const auto shards = static_cast<uint32_t>(state.range(0));
+    const uuidxx::high_bits_shard shard_of;
+    for (auto _ : state) {
+        std::vector<std::size_t> cursors(shards + 1, 0);
+        for (const auto& id : ids) {
+            ++cursors[shard_of(id, shards) + 1];
+        }
+        for (uint32_t s = 1; s <= shards; ++s) {
+            cursors[s] += cursors[s - 1];
+        }
+        for (const auto& id : ids) {
+            out[cursors[shard_of(id, shards)]++] = id;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    set_counters(state);
+}
+
+// Arguments: shards, threads.
+template<typename ShardFn>
+void BM_partition(benchmark::State& state) {
+    const auto& ids = sample_ids();
+    auto& out = output();
+    uuidxx::partition_options opts;
+    opts.threads = static_cast<std::size_t>(state.range(1));
+    for (auto _ : state) {
+        auto bounds = uuidxx::partition(ids.data(), ids.size(),
+                                        static_cast<uint32_t>(state.range(0)), out.data(),
+                                        ShardFn{}, opts);
+        benchmark::DoNotOptimize(bounds.data());
+    }
+    set_counters(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_direct_scatter)->Arg(16)->Arg(256)->Arg(4096)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_partition, uuidxx::high_bits_shard)
+        ->ArgsProduct({{16, 256, 4096}, {1, 0}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_partition, uuidxx::jump_consistent_shard)
+        ->ArgsProduct({{16, 256, 4096}, {1, 0}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,71 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_pool.h"
+#include "uuidxx/uuidxx.h"
+
+#include "bench_utils.h"
+
+namespace {
+
+using uuidxx::bench::latency_recorder;
+
+uuidxx::uuid_pool& large_pool() {
+    static uuidxx::uuid_pool pool(uuidxx::uuid_pool_options{1 << 16, 1 << 14, 0, true, {}});
+    return pool;
+}
+
+// Small enough to be drained by a tight loop, so the inline fallback kicks in.
+uuidxx::uuid_pool& small_pool() {
+    static uuidxx::uuid_pool pool(uuidxx::uuid_pool_options{256, 64, 0, true, {}});
+    return pool;
+}
+
+// The pool is shared by threads, thus only thread 0 reports; it starts counting before,
+// and stops after, all threads run, as both `for (auto _ : state)` and `report()` wait
+// for all threads.
+void report_fallbacks(benchmark::State& state, const uuidxx::uuid_pool& pool,
+                      uint64_t start) {
+    if (state.thread_index() == 0) {
+        state.counters["fallbacks"] = static_cast<double>(pool.fallback_count() - start);
+    }
+}
+
+void BM_make_v4_inline(benchmark::State& state) {
+    latency_recorder recorder;
+    for (auto _ : state) {
+        recorder.measure([] { benchmark::DoNotOptimize(uuidxx::make_v4()); });
+    }
+    recorder.report(state);
+}
+
+void BM_pool_take(benchmark::State& state) {
+    auto& pool = large_pool();
+    auto fallbacks = pool.fallback_count();
+    latency_recorder recorder;
+    for (auto _ : state) {
+        recorder.measure([&pool] { benchmark::DoNotOptimize(pool.take()); });
+    }
+    recorder.report(state);
+    report_fallbacks(state, pool, fallbacks);
+}
+
+void BM_pool_take_drained(benchmark::State& state) {
+    auto& pool = small_pool();
+    auto fallbacks = pool.fallback_count();
+    latency_recorder recorder;
+    for (auto _ : state) {
+        recorder.measure([&pool] { benchmark::DoNotOptimize(pool.take()); });
+    }
+    recorder.report(state);
+    report_fallbacks(state, pool, fallbacks);
+}
+
+} // namespace
+
+BENCHMARK(BM_make_v4_inline)->Threads(1)->Threads(4)->UseRealTime();
+BENCHMARK(BM_pool_take)->Threads(1)->Threads(4)->UseRealTime();
+BENCHMARK(BM_pool_take_drained)->Threads(1)->Threads(4)->UseRealTime();
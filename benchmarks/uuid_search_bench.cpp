@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_search.h"
+#include "uuidxx/uuidxx.h"
+
+#include "bench_utils.h"
+
+namespace {
+
+using uuidxx::bench::make_ids;
+using uuidxx::bench::make_probes;
+
+void BM_std_find(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto probes = make_probes(ids, 1024);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                std::find(ids.begin(), ids.end(), probes[i++ % probes.size()]));
+    }
+}
+
+void BM_simd_find(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto probes = make_probes(ids, 1024);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuidxx::find(ids.data(), ids.size(), probes[i++ % probes.size()]));
+    }
+}
+
+void BM_unordered_set_find(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto probes = make_probes(ids, 1024);
+    std::unordered_set<uuidxx::uuid> set(ids.begin(), ids.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.count(probes[i++ % probes.size()]));
+    }
+}
+
+void BM_simd_count_equal(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto probes = make_probes(ids, 1024);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                uuidxx::count_equal(ids.data(), ids.size(), probes[i++ % probes.size()]));
+    }
+}
+
+// 4 needles, none present; the worst case of both.
+void BM_simd_any_of_many(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto needles = make_ids(4);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                uuidxx::any_of_many(ids.data(), ids.size(), needles.data(), needles.size()));
+    }
+}
+
+void BM_unordered_set_any_of_many(benchmark::State& state) {
+    auto ids = make_ids(static_cast<std::size_t>(state.range(0)));
+    auto needles = make_ids(4);
+    std::unordered_set<uuidxx::uuid> set(ids.begin(), ids.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::any_of(needles.begin(), needles.end(),
+                                             [&set](const auto& id) { return set.count(id); }));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_std_find)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_simd_find)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_unordered_set_find)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_simd_count_equal)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_simd_any_of_many)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_unordered_set_any_of_many)->RangeMultiplier(4)->Range(4, 4096);
@@ -0,0 +1,134 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuid_text_view.h"
+#include "uuidxx/uuidxx.h"
+
+namespace {
+
+// A textual column with every id appearing twice, in either case.
+const std::vector<std::string>& texts() {
+    static auto col = [] {
+        std::vector<std::string> out;
+        for (int i = 0; i < (1 << 16); ++i) {
+            auto str = uuidxx::make_v4().to_string();
+            out.push_back(str);
+            for (auto& ch : str) {
+                ch = static_cast<char>(ch >= 'a' ? ch - 32 : ch);
+            }
+            out.push_back(str);
+        }
+        return out;
+    }();
+    return col;
+}
+
+void BM_dedup_via_make_from(benchmark::State& state) {
+    const auto& col = texts();
+    for (auto _ : state) {
+        std::unordered_set<uuidxx::uuid> set;
+        set.reserve(col.size());
+        for (const auto& text : col) {
+            set.insert(uuidxx::make_from(text));
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+}
+
+void BM_dedup_via_text_view(benchmark::State& state) {
+    const auto& col = texts();
+    for (auto _ : state) {
+        std::unordered_set<uuidxx::uuid_text_view> set;
+        set.reserve(col.size());
+        for (const auto& text : col) {
+            set.insert(*uuidxx::uuid_text_view::make(text));
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+}
+
+void BM_text_view_to_uuid(benchmark::State& state) {
+    const auto& col = texts();
+    std::vector<uuidxx::uuid_text_view> views;
+    for (const auto& text : col) {
+        views.push_back(*uuidxx::uuid_text_view::make(text));
+    }
+
+    for (auto _ : state) {
+        for (const auto& view : views) {
+            benchmark::DoNotOptimize(view.to_uuid());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * views.size()));
+}
+
+void BM_make_from_string(benchmark::State& state) {
+    const auto& col = texts();
+    for (auto _ : state) {
+        for (const auto& text : col) {
+            benchmark::DoNotOptimize(uuidxx::make_from(text));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+}
+
+// Garbage ids, as a malicious client sends; the last digit of each is not hex.
+const std::vector<std::string>& invalid_texts() {
+    static auto col = [] {
+        auto out = texts();
+        for (auto& text : out) {
+            text.back() = 'z';
+        }
+        return out;
+    }();
+    return col;
+}
+
+#if !UUIDXX_NO_EXCEPTIONS
+
+void BM_make_from_invalid_throwing(benchmark::State& state) {
+    const auto& col = invalid_texts();
+    for (auto _ : state) {
+        for (const auto& text : col) {
+            try {
+                benchmark::DoNotOptimize(uuidxx::make_from(text));
+            } catch (const uuidxx::bad_uuid_string&) {
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+}
+
+BENCHMARK(BM_make_from_invalid_throwing);
+
+#endif
+
+void BM_make_from_invalid_error_code(benchmark::State& state) {
+    const auto& col = invalid_texts();
+    std::error_code ec;
+    for (auto _ : state) {
+        for (const auto& text : col) {
+            benchmark::DoNotOptimize(uuidxx::make_from(text, ec));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * col.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_dedup_via_make_from)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_dedup_via_text_view)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_make_from_string);
+BENCHMARK(BM_make_from_invalid_error_code);
+BENCHMARK(BM_text_view_to_uuid);
@@ -0,0 +1,82 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "uuidxx/uuidxx.h"
+#include "uuidxx/v8_layout.h"
+
+namespace {
+
+struct region : uuidxx::v8_field<0, 10> {};
+struct coarse_ts : uuidxx::v8_field<10, 44> {};
+struct shard : uuidxx::v8_field<54, 20> {};
+struct tail : uuidxx::v8_field<74, 48> {};
+
+using routing_layout = uuidxx::v8_layout<region, coarse_ts, shard, tail>;
+
+constexpr std::size_t k_count = 1 << 16;
+
+std::vector<routing_layout::values> make_values() {
+    std::vector<routing_layout::values> vals;
+    uint64_t x = 42;
+    for (std::size_t i = 0; i < k_count; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        vals.push_back({x >> 54, x >> 20, x >> 8, x});
+    }
+    return vals;
+}
+
+void BM_v8_encode(benchmark::State& state) {
+    auto vals = make_values();
+    std::vector<uuidxx::uuid> ids(k_count, uuidxx::k_nil);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_count; ++i) {
+            ids[i] = routing_layout::encode(vals[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_v8_decode(benchmark::State& state) {
+    std::vector<uuidxx::uuid> ids;
+    for (const auto& v : make_values()) {
+        ids.push_back(routing_layout::encode(v));
+    }
+
+    std::vector<routing_layout::values> out(k_count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_count; ++i) {
+            out[i] = routing_layout::decode(ids[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+// What routers do: pick a single field.
+void BM_v8_get_shard(benchmark::State& state) {
+    std::vector<uuidxx::uuid> ids;
+    for (const auto& v : make_values()) {
+        ids.push_back(routing_layout::encode(v));
+    }
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& id : ids) {
+            sum += routing_layout::get<shard>(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+} // namespace
+
+BENCHMARK(BM_v8_encode);
+BENCHMARK(BM_v8_decode);
+BENCHMARK(BM_v8_get_shard);
@@ -0,0 +1,342 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "cli/stream_io.h"
+#include "cli/uuid_codec.h"
+#include "uuidxx/bulk_generation.h"
+#include "uuidxx/uuidxx.h"
+
+namespace uuidxx {
+namespace cli {
+namespace {
+
+constexpr char k_usage[] =
+        "usage:\n"
+        "  uuidxx_cli generate [-v 1|3|4|5] [-n COUNT] [-f FORMAT] [-o FILE] [-t THREADS]\n"
+        "                      [--ns NAMESPACE] [-i FILE]\n"
+        "  uuidxx_cli validate [-i FILE] [--binary]\n"
+        "  uuidxx_cli convert [-i FILE] [--binary] [-f FORMAT] [-o FILE]\n"
+        "\n"
+        "  -v         version to generate; defaults to 4\n"
+        "  -n         number of v1 or v4 uuids; defaults to 1\n"
+        "  -f         output format: canonical (default), compact or binary\n"
+        "  -i, -o     input and output files; defaults to stdin and stdout\n"
+        "  -t         threads for v3, v4 and v5; defaults to number of cores\n"
+        "  --ns       namespace of v3 and v5: dns (default), url, oid, x500 or a uuid;\n"
+        "             each input line is hashed as a name\n"
+        "  --binary   input is of 16-byte records; otherwise text lines of canonical or\n"
+        "             compact uuids\n";
+
+// Number of uuids generated and encoded per round.
+constexpr std::size_t k_batch_size = std::size_t{1} << 16;
+
+enum exit_code : int {
+    k_exit_ok = 0,
+    k_exit_failure = 1,
+    k_exit_usage = 2
+};
+
+struct options {
+    std::string_view command;
+    int version{4};
+    uint64_t count{1};
+    uuid_format format{uuid_format::canonical};
+    const char* input{"-"};
+    const char* output{"-"};
+    uuid ns{k_namespace_dns};
+    std::size_t threads{0};
+    bool binary_input{false};
+};
+
+template<typename T>
+bool parse_number(std::string_view text, T& value) {
+    const auto* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, value);
+    return ec == std::errc() && ptr == end;
+}
+
+std::optional<uuid> parse_namespace(std::string_view text) {
+    if (text == "dns") {
+        return k_namespace_dns;
+    }
+
+    if (text == "url") {
+        return k_namespace_url;
+    }
+
+    if (text == "oid") {
+        return k_namespace_oid;
+    }
+
+    if (text == "x500") {
+        return k_namespace_x500;
+    }
+
+    return decode_text(text);
+}
+
+bool parse_options(int argc, char* argv[], options& opts) {
+    if (argc < 2) {
+        return false;
+    }
+
+    opts.command = argv[1];
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--binary") {
+            opts.binary_input = true;
+            continue;
+        }
+
+        if (i + 1 == argc) {
+            std::fprintf(stderr, "missing value of %s\n", argv[i]);
+            return false;
+        }
+
+        const char* value = argv[++i];
+        bool ok = true;
+        if (arg == "-v") {
+            ok = parse_number(value, opts.version);
+        } else if (arg == "-n") {
+            ok = parse_number(value, opts.count);
+        } else if (arg == "-t") {
+            ok = parse_number(value, opts.threads);
+        } else if (arg == "-f") {
+            auto format = parse_format(value);
+            ok = format.has_value();
+            opts.format = format.value_or(uuid_format::canonical);
+        } else if (arg == "-i") {
+            opts.input = value;
+        } else if (arg == "-o") {
+            opts.output = value;
+        } else if (arg == "--ns") {
+            auto ns = parse_namespace(value);
+            ok = ns.has_value();
+            opts.ns = ns.value_or(k_nil);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i - 1]);
+            return false;
+        }
+
+        if (!ok) {
+            std::fprintf(stderr, "invalid value of %s: %s\n", argv[i - 1], value);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void write_ids(const uuid* ids, std::size_t count, uuid_format format, chunk_writer& writer) {
+    char* out = writer.reserve(count * encoded_size(format));
+    for (std::size_t i = 0; i < count; ++i) {
+        out = encode(ids[i], format, out);
+    }
+    writer.commit(out);
+}
+
+int finish(chunk_writer& writer) {
+    if (!writer.flush()) {
+        std::perror("write failed");
+        return k_exit_failure;
+    }
+    return k_exit_ok;
+}
+
+int generate_counted(const options& opts, chunk_writer& writer) {
+    bulk_options bulk;
+    bulk.threads = opts.threads;
+
+    std::vector<uuid> ids(k_batch_size, k_nil);
+    for (auto remaining = opts.count; remaining > 0;) {
+        const auto n = static_cast<std::size_t>(std::min<uint64_t>(remaining, k_batch_size));
+        if (opts.version == 1) {
+            std::generate_n(ids.begin(), n, [] { return make_v1(); });
+        } else {
+            make_v4_bulk(ids.data(), n, bulk);
+        }
+
+        write_ids(ids.data(), n, opts.format, writer);
+        remaining -= n;
+    }
+
+    return finish(writer);
+}
+
+int generate_named(const options& opts, chunk_writer& writer) {
+    std::FILE* input = open_input(opts.input);
+    if (input == nullptr) {
+        std::perror(opts.input);
+        return k_exit_failure;
+    }
+
+    bulk_options bulk;
+    bulk.threads = opts.threads;
+
+    chunk_reader reader(input);
+    std::vector<std::string_view> names;
+    std::vector<uuid> ids(k_batch_size, k_nil);
+    while (reader.next_lines(names)) {
+        for (std::size_t first = 0; first < names.size(); first += k_batch_size) {
+            const auto n = std::min(names.size() - first, k_batch_size);
+            if (opts.version == 3) {
+                make_v3_bulk(opts.ns, names.data() + first, n, ids.data(), bulk);
+            } else {
+                make_v5_bulk(opts.ns, names.data() + first, n, ids.data(), bulk);
+            }
+            write_ids(ids.data(), n, opts.format, writer);
+        }
+    }
+
+    if (reader.failed()) {
+        std::fprintf(stderr, "failed to read names, or a name is too long\n");
+        return k_exit_failure;
+    }
+
+    return finish(writer);
+}
+
+bool is_generated_version(int version) {
+    return version == 1 || version == 3 || version == 4 || version == 5;
+}
+
+int run_generate(const options& opts, chunk_writer& writer) {
+    return opts.version == 1 || opts.version == 4 ? generate_counted(opts, writer)
+                                                  : generate_named(opts, writer);
+}
+
+// Calls `fn(id, line_no, text)` on each input uuid, where `id` is empty if the line is
+// invalid; `fn` returns false to stop.
+template<typename Fn>
+int for_each_input(const options& opts, Fn fn) {
+    std::FILE* input = open_input(opts.input);
+    if (input == nullptr) {
+        std::perror(opts.input);
+        return k_exit_failure;
+    }
+
+    chunk_reader reader(input);
+    uint64_t line_no = 0;
+    if (opts.binary_input) {
+        std::string_view records;
+        while (reader.next_records(16, records)) {
+            for (std::size_t pos = 0; pos < records.size(); pos += 16) {
+                fn(std::optional<uuid>(decode_binary(records.data() + pos)), ++line_no,
+                   std::string_view());
+            }
+        }
+    } else {
+        std::vector<std::string_view> lines;
+        while (reader.next_lines(lines)) {
+            for (auto line : lines) {
+                if (!fn(decode_text(line), ++line_no, line)) {
+                    return k_exit_failure;
+                }
+            }
+        }
+    }
+
+    if (reader.failed()) {
+        std::fprintf(stderr, "failed to read input, a line is too long, or the last record "
+                             "is truncated\n");
+        return k_exit_failure;
+    }
+
+    return k_exit_ok;
+}
+
+int run_validate(const options& opts) {
+    uint64_t total = 0;
+    uint64_t invalid = 0;
+    int rv = for_each_input(opts, [&](const std::optional<uuid>& id, uint64_t line_no,
+                                      std::string_view text) {
+        ++total;
+        if (!id) {
+            ++invalid;
+            std::fprintf(stderr, "line %llu: %.*s\n", static_cast<unsigned long long>(line_no),
+                         static_cast<int>(std::min<std::size_t>(text.size(), 64)), text.data());
+        }
+        return true;
+    });
+
+    std::fprintf(stderr, "%llu uuids, %llu invalid\n", static_cast<unsigned long long>(total),
+                 static_cast<unsigned long long>(invalid));
+    return rv == k_exit_ok && invalid == 0 ? k_exit_ok : k_exit_failure;
+}
+
+int run_convert(const options& opts, chunk_writer& writer) {
+    const auto size = encoded_size(opts.format);
+    int rv = for_each_input(opts, [&](const std::optional<uuid>& id, uint64_t line_no,
+                                      std::string_view) {
+        if (!id) {
+            std::fprintf(stderr, "line %llu: invalid uuid\n",
+                         static_cast<unsigned long long>(line_no));
+            return false;
+        }
+        writer.commit(encode(*id, opts.format, writer.reserve(size)));
+        return true;
+    });
+
+    return rv == k_exit_ok ? finish(writer) : rv;
+}
+
+int run(int argc, char* argv[]) {
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::fputs(k_usage, stderr);
+        return k_exit_usage;
+    }
+
+    if (opts.command == "validate") {
+        return run_validate(opts);
+    }
+
+    if (opts.command != "generate" && opts.command != "convert") {
+        std::fputs(k_usage, stderr);
+        return k_exit_usage;
+    }
+
+    // Checked before opening the output, which truncates an existing file.
+    if (opts.command == "generate" && !is_generated_version(opts.version)) {
+        std::fprintf(stderr, "unsupported version %d; only 1, 3, 4 and 5 are generated\n",
+                     opts.version);
+        return k_exit_usage;
+    }
+
+    std::FILE* output = open_output(opts.output);
+    if (output == nullptr) {
+        std::perror(opts.output);
+        return k_exit_failure;
+    }
+
+    int rv;  // NOLINT(cppcoreguidelines-init-variables)
+    {
+        chunk_writer writer(output);
+        rv = opts.command == "generate" ? run_generate(opts, writer)
+                                        : run_convert(opts, writer);
+    }
+
+    if (!close_output(output) && rv == k_exit_ok) {
+        std::perror(opts.output);
+        return k_exit_failure;
+    }
+    return rv;
+}
+
+} // namespace
+} // namespace cli
+} // namespace uuidxx
+
+int main(int argc, char* argv[]) {
+    return uuidxx::cli::run(argc, argv);
+}
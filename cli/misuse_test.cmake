@@ -0,0 +1,23 @@
+# Checks exit codes of uuidxx_cli on invalid input and arguments.
+# Usage: cmake -DCLI=path/to/uuidxx_cli -P misuse_test.cmake, in a scratch directory.
+
+function(expect_exit CODE)
+  execute_process(COMMAND ${CLI} ${ARGN} RESULT_VARIABLE rv ERROR_VARIABLE err)
+  if(NOT rv EQUAL CODE)
+    message(FATAL_ERROR "`${ARGN}` exited with ${rv} rather than ${CODE}: ${err}")
+  endif()
+endfunction()
+
+file(WRITE cli_invalid.txt
+  "6ba7b810-9dad-11d1-80b4-00c04fd430c8\n"
+  "6ba7b810-9dad-11d1-80b4-00c04fd430cx\n"
+  "6ba7b8109dad11d180b400c04fd430c8\n")
+expect_exit(1 validate -i cli_invalid.txt)
+
+# Unsupported versions are rejected before an existing output is truncated.
+file(WRITE cli_keep.txt "keep\n")
+expect_exit(2 generate -v 7 -o cli_keep.txt)
+file(READ cli_keep.txt kept)
+if(NOT kept STREQUAL "keep\n")
+  message(FATAL_ERROR "output was truncated by a rejected command")
+endif()
@@ -0,0 +1,152 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "cli/stream_io.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace uuidxx {
+namespace cli {
+namespace {
+
+std::FILE* open_stream(const char* path, std::FILE* standard, const char* mode) {
+    if (std::strcmp(path, "-") != 0) {
+        return std::fopen(path, mode);
+    }
+
+#if defined(_WIN32)
+    if (_setmode(_fileno(standard), _O_BINARY) == -1) {
+        return nullptr;
+    }
+#endif
+    return standard;
+}
+
+} // namespace
+
+std::FILE* open_input(const char* path) {
+    return open_stream(path, stdin, "rb");
+}
+
+std::FILE* open_output(const char* path) {
+    return open_stream(path, stdout, "wb");
+}
+
+bool close_output(std::FILE* file) {
+    if (file == stdout) {
+        return std::fflush(file) == 0 && std::ferror(file) == 0;
+    }
+    return std::fclose(file) == 0;
+}
+
+chunk_reader::chunk_reader(std::FILE* file, std::size_t capacity)
+    : file_(file),
+      buf_(new char[capacity]),
+      capacity_(capacity) {
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+}
+
+bool chunk_reader::refill() {
+    if (eof_ || failed_) {
+        return false;
+    }
+
+    std::memmove(buf_.get(), buf_.get() + begin_, end_ - begin_);
+    end_ -= begin_;
+    begin_ = 0;
+
+    const auto n = std::fread(buf_.get() + end_, 1, capacity_ - end_, file_);
+    end_ += n;
+    if (n == 0) {
+        eof_ = true;
+        failed_ = std::ferror(file_) != 0;
+    }
+
+    return n > 0;
+}
+
+bool chunk_reader::next_lines(std::vector<std::string_view>& lines) {
+    lines.clear();
+    for (;;) {
+        const char* data = buf_.get();
+        auto pos = begin_;
+        for (const char* nl = nullptr;
+             (nl = static_cast<const char*>(std::memchr(data + pos, '\n', end_ - pos)));) {
+            const auto next = static_cast<std::size_t>(nl - data);
+            const auto len = next > pos && data[next - 1] == '\r' ? next - pos - 1 : next - pos;
+            lines.emplace_back(data + pos, len);
+            pos = next + 1;
+        }
+        begin_ = pos;
+
+        if (!lines.empty()) {
+            return true;
+        }
+
+        if (end_ - begin_ == capacity_) {
+            failed_ = true;
+            return false;
+        }
+
+        if (!refill()) {
+            // The last line without a line break.
+            if (!failed_ && begin_ < end_) {
+                lines.emplace_back(data + begin_, end_ - begin_);
+                begin_ = end_;
+                return true;
+            }
+            return false;
+        }
+    }
+}
+
+bool chunk_reader::next_records(std::size_t size, std::string_view& records) {
+    for (;;) {
+        const auto n = (end_ - begin_) / size * size;
+        if (n > 0) {
+            records = std::string_view(buf_.get() + begin_, n);
+            begin_ += n;
+            return true;
+        }
+
+        if (!refill()) {
+            failed_ = failed_ || begin_ < end_;
+            return false;
+        }
+    }
+}
+
+chunk_writer::chunk_writer(std::FILE* file, std::size_t capacity)
+    : file_(file),
+      buf_(new char[capacity]),
+      capacity_(capacity) {
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+}
+
+chunk_writer::~chunk_writer() {
+    flush();
+}
+
+char* chunk_writer::reserve(std::size_t size) {
+    if (capacity_ - size_ < size) {
+        flush();
+    }
+    return buf_.get() + size_;
+}
+
+bool chunk_writer::flush() {
+    if (size_ > 0 && !failed_) {
+        failed_ = std::fwrite(buf_.get(), 1, size_, file_) != size_ || std::fflush(file_) != 0;
+    }
+    size_ = 0;
+    return !failed_;
+}
+
+} // namespace cli
+} // namespace uuidxx
@@ -0,0 +1,112 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CLI_STREAM_IO_H_
+#define UUIDXX_CLI_STREAM_IO_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace uuidxx {
+namespace cli {
+
+// Opens `path` for binary I/O; "-" means stdin or stdout, which are switched into
+// binary mode.
+// Returns nullptr on failure.
+std::FILE* open_input(const char* path);
+
+std::FILE* open_output(const char* path);
+
+// Closes a stream from `open_output()`, or only flushes it if it is stdout.
+// Returns false if any write to it failed, including those reported only on close.
+bool close_output(std::FILE* file);
+
+// Reads a stream in large blocks, and hands out whole lines or records straight from its
+// buffer, without copying.
+class chunk_reader {
+public:
+    static constexpr std::size_t k_default_capacity = std::size_t{1} << 22;
+
+    explicit chunk_reader(std::FILE* file, std::size_t capacity = k_default_capacity);
+
+    chunk_reader(const chunk_reader&) = delete;
+
+    chunk_reader(chunk_reader&&) = delete;
+
+    chunk_reader& operator=(const chunk_reader&) = delete;
+
+    chunk_reader& operator=(chunk_reader&&) = delete;
+
+    // Replaces `lines` with the next lines, without line breaks, which stay valid until the
+    // next call. The last line needs no line break.
+    // Returns false at the end of the stream, or on error, see `failed()`.
+    bool next_lines(std::vector<std::string_view>& lines);
+
+    // Sets `records` to the next records of `size` bytes each, valid until the next call.
+    // Returns false at the end of the stream, or on error, see `failed()`.
+    bool next_records(std::size_t size, std::string_view& records);
+
+    // True if reading failed, a line didn't fit into the buffer, or the stream ended in
+    // the middle of a record.
+    [[nodiscard]] bool failed() const noexcept {
+        return failed_;
+    }
+
+private:
+    // Moves unconsumed bytes to the front and reads more; returns false if nothing was read.
+    bool refill();
+
+private:
+    std::FILE* file_;
+    std::unique_ptr<char[]> buf_;
+    std::size_t capacity_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    bool eof_{false};
+    bool failed_{false};
+};
+
+// Buffers output, so that each write to the stream is of the buffer size.
+class chunk_writer {
+public:
+    static constexpr std::size_t k_default_capacity = std::size_t{1} << 22;
+
+    explicit chunk_writer(std::FILE* file, std::size_t capacity = k_default_capacity);
+
+    ~chunk_writer();
+
+    chunk_writer(const chunk_writer&) = delete;
+
+    chunk_writer(chunk_writer&&) = delete;
+
+    chunk_writer& operator=(const chunk_writer&) = delete;
+
+    chunk_writer& operator=(chunk_writer&&) = delete;
+
+    // Returns room for at least `size` bytes, which must not exceed the capacity; pass the
+    // end of the written bytes to `commit()`.
+    char* reserve(std::size_t size);
+
+    void commit(char* end) noexcept {
+        size_ = static_cast<std::size_t>(end - buf_.get());
+    }
+
+    // Returns false if any write so far failed.
+    bool flush();
+
+private:
+    std::FILE* file_;
+    std::unique_ptr<char[]> buf_;
+    std::size_t capacity_;
+    std::size_t size_{0};
+    bool failed_{false};
+};
+
+} // namespace cli
+} // namespace uuidxx
+
+#endif // UUIDXX_CLI_STREAM_IO_H_
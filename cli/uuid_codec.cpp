@@ -0,0 +1,121 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "cli/uuid_codec.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "uuidxx/bit_utils.h"
+#include "uuidxx/endian_utils.h"
+#include "uuidxx/uuid_text_view.h"
+
+namespace uuidxx {
+namespace cli {
+namespace {
+
+constexpr std::array<char, 512> make_hex_pairs() {
+    constexpr char digits[] = "0123456789abcdef";
+    std::array<char, 512> pairs{};
+    for (std::size_t i = 0; i < 256; ++i) {
+        pairs[i * 2] = digits[i >> 4];
+        pairs[i * 2 + 1] = digits[i & 0x0f];
+    }
+    return pairs;
+}
+
+constexpr auto k_hex_pairs = make_hex_pairs();
+
+// Writes `bytes` bytes of `word`, from the most significant one.
+char* put_hex(uint64_t word, int bytes, char* out) noexcept {
+    for (int i = bytes - 1; i >= 0; --i) {
+        std::memcpy(out, &k_hex_pairs[((word >> (i * 8)) & 0xff) * 2], 2);
+        out += 2;
+    }
+    return out;
+}
+
+std::optional<uuid> decode_compact(std::string_view text) noexcept {
+    uuid::data raw{0, 0};
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        const int v = details::hex_value(text[i]);
+        if (v < 0) {
+            return std::nullopt;
+        }
+        raw[i / 16] = (raw[i / 16] << 4) | static_cast<uint64_t>(v);
+    }
+    return uuid(raw, details::gen_from_raw_data);
+}
+
+} // namespace
+
+std::optional<uuid_format> parse_format(std::string_view name) noexcept {
+    if (name == "canonical") {
+        return uuid_format::canonical;
+    }
+
+    if (name == "compact") {
+        return uuid_format::compact;
+    }
+
+    if (name == "binary") {
+        return uuid_format::binary;
+    }
+
+    return std::nullopt;
+}
+
+char* encode(const uuid& id, uuid_format format, char* out) noexcept {
+    const auto& raw = id.raw_data();
+    switch (format) {
+    case uuid_format::canonical:
+        out = put_hex(raw[0] >> 32, 4, out);
+        *out++ = '-';
+        out = put_hex(raw[0] >> 16, 2, out);
+        *out++ = '-';
+        out = put_hex(raw[0], 2, out);
+        *out++ = '-';
+        out = put_hex(raw[1] >> 48, 2, out);
+        *out++ = '-';
+        out = put_hex(raw[1], 6, out);
+        *out++ = '\n';
+        return out;
+    case uuid_format::compact:
+        out = put_hex(raw[0], 8, out);
+        out = put_hex(raw[1], 8, out);
+        *out++ = '\n';
+        return out;
+    case uuid_format::binary:
+    default: {
+        const uint64_t be[2]{byteswap(raw[0]), byteswap(raw[1])};
+        std::memcpy(out, be, sizeof(be));
+        return out + sizeof(be);
+    }
+    }
+}
+
+std::optional<uuid> decode_text(std::string_view text) noexcept {
+    if (text.size() == 32) {
+        return decode_compact(text);
+    }
+
+    auto view = uuid_text_view::make(text);
+    if (!view) {
+        return std::nullopt;
+    }
+
+    return view->to_uuid();
+}
+
+uuid decode_binary(const char* bytes) noexcept {
+    uuid::data raw;
+    std::memcpy(raw.data(), bytes, sizeof(raw));
+    raw[0] = byteswap(raw[0]);
+    raw[1] = byteswap(raw[1]);
+    return uuid(raw, details::gen_from_raw_data);
+}
+
+} // namespace cli
+} // namespace uuidxx
@@ -0,0 +1,53 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CLI_UUID_CODEC_H_
+#define UUIDXX_CLI_UUID_CODEC_H_
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+namespace cli {
+
+enum class uuid_format {
+    // xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, one per line.
+    canonical,
+    // 32 hex digits, one per line.
+    compact,
+    // 16 bytes in network order, no separator.
+    binary
+};
+
+std::optional<uuid_format> parse_format(std::string_view name) noexcept;
+
+// Bytes written by `encode()`, including the newline of text formats.
+constexpr std::size_t encoded_size(uuid_format format) noexcept {
+    switch (format) {
+    case uuid_format::canonical:
+        return 37;
+    case uuid_format::compact:
+        return 33;
+    case uuid_format::binary:
+    default:
+        return 16;
+    }
+}
+
+// Writes exactly `encoded_size(format)` bytes, in lower case, and returns the end.
+char* encode(const uuid& id, uuid_format format, char* out) noexcept;
+
+// Accepts canonical strings, optionally in braces, and compact strings, in either case.
+std::optional<uuid> decode_text(std::string_view text) noexcept;
+
+// `bytes` must have 16 bytes.
+uuid decode_binary(const char* bytes) noexcept;
+
+} // namespace cli
+} // namespace uuidxx
+
+#endif // UUIDXX_CLI_UUID_CODEC_H_
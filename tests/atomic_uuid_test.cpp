@@ -0,0 +1,98 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/atomic_uuid.h"
+#include "uuidxx/uuidxx.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+std::unique_ptr<atomic_uuid> make_atomic(bool seqlock, const uuid& id) {
+    return seqlock ? std::make_unique<atomic_uuid>(id, details::use_seqlock)
+                   : std::make_unique<atomic_uuid>(id);
+}
+
+// Both words carry the same counter, thus torn reads are detectable.
+uuid counter_id(uint64_t n) {
+    return make_from_raw_data({n, n});
+}
+
+} // namespace
+
+TEST_CASE("Atomic uuid layout", "[atomic_uuid]") {
+    CHECK(alignof(atomic_uuid) >= 16);
+    CHECK(atomic_uuid(k_nil).is_lock_free() == details::cas16().cas);
+    CHECK_FALSE(atomic_uuid(k_nil, details::use_seqlock).is_lock_free());
+}
+
+TEST_CASE("Atomic uuid operations", "[atomic_uuid]") {
+    const bool seqlock = GENERATE(false, true);
+    const auto a = make_v4();
+    const auto b = make_v4();
+    auto value = make_atomic(seqlock, a);
+
+    CHECK(value->load() == a);
+
+    value->store(b);
+    CHECK(value->load() == b);
+
+    CHECK(value->exchange(a) == b);
+    CHECK(value->load() == a);
+
+    auto expected = b;
+    CHECK_FALSE(value->compare_exchange(expected, k_nil));
+    CHECK(expected == a);
+    CHECK(value->compare_exchange(expected, k_nil));
+    CHECK(value->load() == k_nil);
+
+    // Zeros, which loading by compare-and-swap writes back.
+    CHECK(value->exchange(b) == k_nil);
+}
+
+TEST_CASE("Atomic uuid under contention", "[atomic_uuid]") {
+    const bool seqlock = GENERATE(false, true);
+    constexpr int k_writers = 4;
+    constexpr int k_increments = 20000;
+    auto value = make_atomic(seqlock, counter_id(0));
+
+    std::atomic<bool> torn{false};
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+        while (!done.load()) {
+            const auto id = value->load();
+            if (id.raw_data()[0] != id.raw_data()[1]) {
+                torn = true;
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < k_writers; ++i) {
+        writers.emplace_back([&] {
+            for (int n = 0; n < k_increments; ++n) {
+                auto expected = value->load();
+                while (!value->compare_exchange(expected,
+                                                counter_id(expected.raw_data()[0] + 1))) {
+                }
+            }
+        });
+    }
+
+    for (auto& th : writers) {
+        th.join();
+    }
+    done = true;
+    reader.join();
+
+    CHECK_FALSE(torn.load());
+    CHECK(value->load() == counter_id(k_writers * k_increments));
+}
+
+} // namespace uuidxx
@@ -0,0 +1,93 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/basic_generator.h"
+#include "uuidxx/uuidxx.h"
+
+#include <set>
+#include <type_traits>
+
+namespace uuidxx {
+namespace {
+
+constexpr node_id k_test_node{std::byte{0x02}, std::byte{0x00}, std::byte{0x5e},
+                              std::byte{0x10}, std::byte{0x20}, std::byte{0x30}};
+
+// Stateless policies are compiled away.
+static_assert(sizeof(default_generator) == sizeof(mac_node));
+static_assert(std::is_empty_v<shared_clock> && std::is_empty_v<global_rand>);
+
+// Would fail to compile if any of them requires dynamic initialization.
+UUIDXX_CONSTINIT default_generator g_default_gen;
+UUIDXX_CONSTINIT thread_local local_generator t_local_gen(local_clock{}, local_rand{},
+                                                          fixed_node(k_test_node));
+constexpr local_rand k_seeded_rand(42);
+
+} // namespace
+
+TEST_CASE("Default generator behaves like free functions", "[basic_generator]") {
+    auto v1 = g_default_gen.make_v1();
+    CHECK(v1.version() == version::v1);
+    CHECK(v1.is_valid_rfc());
+    CHECK(v1.node() == make_v1().node());
+
+    auto v4 = g_default_gen.make_v4();
+    CHECK(v4.version() == version::v4);
+    CHECK(v4.is_valid_rfc());
+}
+
+TEST_CASE("Local generator", "[basic_generator]") {
+    std::set<uuid> ids;
+    for (int i = 0; i < 10000; ++i) {
+        auto id = t_local_gen.make_v1();
+        REQUIRE(id.version() == version::v1);
+        REQUIRE(id.node() == k_test_node);
+        ids.insert(id);
+    }
+    CHECK(ids.size() == 10000);
+
+    std::set<uuid> rand_ids;
+    for (int i = 0; i < 10000; ++i) {
+        rand_ids.insert(t_local_gen.make_v4());
+    }
+    CHECK(rand_ids.size() == 10000);
+}
+
+TEST_CASE("Local clock bumps sequence on collision", "[basic_generator]") {
+    local_clock clock(0x1234);
+    auto [ts1, seq1] = clock.read();
+    auto [ts2, seq2] = clock.read();
+    CHECK(seq1 >= 0x1234);
+    if (ts2 <= ts1) {
+        CHECK(seq2 == static_cast<uint16_t>(seq1 + 1));
+    } else {
+        CHECK(seq2 == seq1);
+    }
+}
+
+TEST_CASE("Seeded local rand is deterministic", "[basic_generator]") {
+    auto r1 = k_seeded_rand;
+    auto r2 = k_seeded_rand;
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(r1() == r2());
+    }
+
+    basic_generator<shared_clock, local_rand, mac_node> g1({}, local_rand(7), {});
+    basic_generator<shared_clock, local_rand, mac_node> g2({}, local_rand(7), {});
+    CHECK(g1.make_v4() == g2.make_v4());
+    CHECK(g1.make_v4() != g1.make_v4());
+}
+
+TEST_CASE("Construct v1 from components", "[basic_generator]") {
+    // c232ab00-9414-11ec-b3c8-9f6bdeced846 from RFC 9562.
+    constexpr uint64_t ts = 0x1ec'9414'c232'ab00;
+    node_id node{std::byte{0x9f}, std::byte{0x6b}, std::byte{0xde},
+                 std::byte{0xce}, std::byte{0xd8}, std::byte{0x46}};
+    uuid id(ts, 0x33c8, node, details::gen_v1);
+    CHECK(id.to_string() == "c232ab00-9414-11ec-b3c8-9f6bdeced846");
+}
+
+} // namespace uuidxx
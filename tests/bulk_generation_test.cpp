@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/bulk_generation.h"
+#include "uuidxx/uuidxx.h"
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace uuidxx {
+
+TEST_CASE("Bulk name-based generation", "[bulk]") {
+    std::vector<std::string> storage;
+    for (int i = 0; i < 20000; ++i) {
+        storage.push_back("name-" + std::to_string(i));
+    }
+    std::vector<std::string_view> names(storage.begin(), storage.end());
+
+    // Also on misaligned output and with more threads than cores.
+    auto threads = GENERATE(as<std::size_t>{}, 1, 3, 8);
+    auto offset = GENERATE(as<std::size_t>{}, 0, 1);
+    bulk_options opts;
+    opts.threads = threads;
+    opts.min_ids_per_thread = 100;
+
+    std::vector<uuid> v3(names.size() + offset, k_nil);
+    std::vector<uuid> v5(names.size() + offset, k_nil);
+    make_v3_bulk(k_namespace_url, names.data(), names.size(), v3.data() + offset, opts);
+    make_v5_bulk(k_namespace_url, names.data(), names.size(), v5.data() + offset, opts);
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        REQUIRE(v3[i + offset] == make_v3(k_namespace_url, names[i]));
+        REQUIRE(v5[i + offset] == make_v5(k_namespace_url, names[i]));
+    }
+}
+
+TEST_CASE("Bulk random generation", "[bulk]") {
+    bulk_options opts;
+    opts.threads = 4;
+    opts.min_ids_per_thread = 1000;
+
+    std::vector<uuid> ids(50000, k_nil);
+    make_v4_bulk(ids.data(), ids.size(), opts);
+
+    std::set<uuid> distinct(ids.begin(), ids.end());
+    CHECK(distinct.size() == ids.size());
+    for (const auto& id : ids) {
+        REQUIRE(id.version() == version::v4);
+        REQUIRE(id.variant() == uuid_variant::rfc4122);
+    }
+}
+
+TEST_CASE("Bulk generation of nothing", "[bulk]") {
+    make_v4_bulk(nullptr, 0);
+    make_v5_bulk(k_namespace_dns, nullptr, 0, nullptr);
+}
+
+} // namespace uuidxx
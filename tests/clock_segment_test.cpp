@@ -0,0 +1,127 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/clock_segment.h"
+#include "uuidxx/clock_sequence.h"
+#include "uuidxx/mapped_file.h"
+#include "uuidxx/stats.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace uuidxx {
+
+TEST_CASE("Named segments share one timestamp stream", "[clock_segment]") {
+    // Unique per run, as concurrent runs would share one segment otherwise.
+    const std::string name =
+            "uuidxx_clock_segment_test_" + std::to_string(std::random_device{}());
+    details::mapped_file::remove_shared(name);
+
+    details::clock_segment seg1;
+    details::clock_segment seg2;
+    REQUIRE(seg1.open_named(name, 0x0123));
+    REQUIRE(seg2.open_named(name, 0x0456));
+
+    uint64_t last = 0;
+    for (int i = 0; i < 10000; ++i) {
+        auto& seg = i % 2 == 0 ? seg1 : seg2;
+        auto [ts, seq] = seg.read(clock_sequence::get_timestamp_since_epoch());
+        REQUIRE(ts > last);
+        // The creator decides.
+        REQUIRE(seq == 0x0123);
+        last = ts;
+    }
+
+    SECTION("Clock set backward") {
+        auto [ts, seq] = seg2.read(last - 1'000'000);
+        CHECK(ts == last + 1);
+    }
+
+    details::mapped_file::remove_shared(name);
+}
+
+TEST_CASE("Collisions and regressions are told apart", "[clock_segment][stats]") {
+    details::clock_segment seg;
+    REQUIRE(seg.open_anonymous(0));
+    reset_stats();
+
+    // Timestamps run ahead of a clock that stays within one tick.
+    for (uint64_t i = 0; i < 4; ++i) {
+        auto [ts, seq] = seg.read(1000);
+        REQUIRE(ts == 1000 + i);
+    }
+
+    auto snapshot = stats();
+#if UUIDXX_ENABLE_STATS
+    CHECK(snapshot.get(stat_counter::clock_collision) == 3);
+    CHECK(snapshot.get(stat_counter::clock_regression) == 0);
+#else
+    CHECK(snapshot.get(stat_counter::clock_collision) == 0);
+#endif
+
+    seg.read(999);
+    snapshot = stats();
+#if UUIDXX_ENABLE_STATS
+    CHECK(snapshot.get(stat_counter::clock_collision) == 3);
+    CHECK(snapshot.get(stat_counter::clock_regression) == 1);
+#else
+    CHECK(snapshot.get(stat_counter::clock_regression) == 0);
+#endif
+
+    reset_stats();
+}
+
+#if !defined(_WIN32)
+
+TEST_CASE("Anonymous segment shared by forked processes", "[clock_segment]") {
+    constexpr int k_procs = 16;
+    constexpr int k_reads = 20000;
+    constexpr uint16_t k_seq = 0x0abc;
+
+    details::clock_segment seg;
+    REQUIRE(seg.open_anonymous(k_seq));
+
+    details::mapped_file results;
+    REQUIRE(results.open_anonymous(sizeof(uint64_t) * k_procs * k_reads));
+    auto out = static_cast<uint64_t*>(results.data());
+
+    std::vector<pid_t> children;
+    for (int p = 0; p < k_procs; ++p) {
+        const pid_t pid = fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0) {
+            for (int i = 0; i < k_reads; ++i) {
+                auto [ts, seq] = seg.read(clock_sequence::get_timestamp_since_epoch());
+                out[p * k_reads + i] = seq == k_seq ? ts : 0;
+            }
+            _exit(0);
+        }
+        children.push_back(pid);
+    }
+
+    for (auto pid : children) {
+        int status = 0;
+        REQUIRE(waitpid(pid, &status, 0) == pid);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+
+    std::vector<uint64_t> stamps(out, out + k_procs * k_reads);
+    CHECK(std::count(stamps.begin(), stamps.end(), 0) == 0);
+    std::sort(stamps.begin(), stamps.end());
+    CHECK(std::adjacent_find(stamps.begin(), stamps.end()) == stamps.end());
+}
+
+#endif
+
+} // namespace uuidxx
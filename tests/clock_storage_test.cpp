@@ -0,0 +1,155 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/clock_sequence.h"
+#include "uuidxx/clock_storage.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <tuple>
+
+namespace uuidxx {
+namespace {
+
+constexpr uint64_t k_window = 10'000'000;
+
+std::string temp_file_path(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+} // namespace
+
+TEST_CASE("Clock storage across restarts", "[clock_storage]") {
+    auto path = temp_file_path("uuidxx_clock_storage_test");
+    constexpr uint64_t now = 0x1ec'9414'c232'ab00;
+
+    {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+
+        uint16_t seq = 0x1234;
+        storage.restore(now, seq);
+        CHECK(seq == 0x1234);
+        CHECK(storage.reserved_until() == now + k_window);
+
+        SECTION("Updates within the window don't reserve") {
+            storage.update(now + k_window, 0x1235);
+            CHECK(storage.reserved_until() == now + k_window);
+            storage.update(now + k_window + 1, 0x1235);
+            CHECK(storage.reserved_until() == now + 2 * k_window + 1);
+        }
+    }
+
+    SECTION("Restart within the window takes the given sequence") {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+
+        uint16_t seq = 0x2a5c;
+        storage.restore(now + 1, seq);
+        CHECK(seq == 0x2a5c);
+        // Never shrinks the window.
+        CHECK(storage.reserved_until() == now + k_window + 1);
+    }
+
+    SECTION("Restart within the window avoids the stored sequence") {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+
+        uint16_t seq = 0x5234;
+        storage.restore(now + 1, seq);
+        CHECK(seq == 0x5235);
+    }
+
+    SECTION("Restart after the window keeps sequence") {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+
+        uint16_t seq = 0;
+        storage.restore(now + k_window + 1, seq);
+        CHECK(seq == 0x1234);
+    }
+
+    SECTION("Clock set backward takes the given sequence") {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+
+        uint16_t seq = 0x2a5c;
+        storage.restore(now - 1000 * k_window, seq);
+        CHECK(seq == 0x2a5c);
+        CHECK(storage.reserved_until() == now + k_window);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Clock storage after losing unflushed updates", "[clock_storage]") {
+    auto path = temp_file_path("uuidxx_clock_storage_unflushed");
+    constexpr uint64_t now = 0x1ec'9414'c232'ab00;
+
+    // As left by a power loss: the reservation was flushed with 0x1234, while updates to
+    // 0x1235 and beyond within the window were not.
+    {
+        const details::clock_storage::state st{details::clock_storage::k_magic,
+                                               details::clock_storage::k_version,
+                                               now + k_window, 0x1234};
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&st), sizeof(st));
+    }
+
+    details::clock_storage storage;
+    REQUIRE(storage.open(path, k_window));
+
+    // Any of 0x1235 and onward might have been issued; so the stored one is not followed.
+    uint16_t seq = 0x0e01;
+    storage.restore(now + k_window / 2, seq);
+    CHECK(seq == 0x0e01);
+    CHECK(storage.reserved_until() == now + k_window / 2 + k_window);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Clock storage rejects foreign files", "[clock_storage]") {
+    auto path = temp_file_path("uuidxx_clock_storage_foreign");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "definitely not a clock state";
+    }
+
+    details::clock_storage storage;
+    CHECK_FALSE(storage.open(path, k_window));
+    CHECK_FALSE(storage.is_open());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Clock sequence with stable storage", "[clock_storage]") {
+    auto path = temp_file_path("uuidxx_clock_sequence_state");
+
+    uint16_t issued = 0;
+    {
+        // Leaves the process-wide one to generation in other tests.
+        clock_sequence clock;
+        REQUIRE(clock.use_stable_storage(path));
+        CHECK_FALSE(clock.use_stable_storage(path));
+        issued = std::get<1>(clock.read());
+    }
+
+    {
+        details::clock_storage storage;
+        REQUIRE(storage.open(path, k_window));
+        // Past the reservation window of one second, the stored sequence is taken.
+        uint16_t seq = 0;
+        storage.restore(clock_sequence::get_timestamp_since_epoch() + 2 * k_window, seq);
+        CHECK(seq == issued);
+    }
+
+    std::filesystem::remove(path);
+}
+
+} // namespace uuidxx
@@ -0,0 +1,125 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/sorted_uuid_index.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+std::string hex_digits(const uuid& id) {
+    auto str = id.to_string();
+    str.erase(std::remove(str.begin(), str.end(), '-'), str.end());
+    return str;
+}
+
+} // namespace
+
+TEST_CASE("Empty index", "[sorted_uuid_index]") {
+    sorted_uuid_index index;
+    REQUIRE(index.empty());
+    REQUIRE_FALSE(index.contains(make_v4()));
+    REQUIRE(index.prefix_range("ab")->empty());
+    REQUIRE_FALSE(index.resolve("ab").has_value());
+}
+
+TEST_CASE("Lookups agree with std::lower_bound", "[sorted_uuid_index]") {
+    auto gen = GENERATE(test::gen_v1, test::gen_v4);
+    auto ids = test::make_ids(5000, gen);
+
+    // Duplicates are removed.
+    auto input = ids;
+    input.insert(input.end(), ids.begin(), ids.begin() + 100);
+    sorted_uuid_index index(input);
+    REQUIRE(index.size() == ids.size());
+
+    std::sort(ids.begin(), ids.end());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(index.at(i) == ids[i]);
+        REQUIRE(index.find(ids[i]) == i);
+    }
+
+    for (int i = 0; i < 5000; ++i) {
+        auto probe = gen();
+        auto expected = std::lower_bound(ids.begin(), ids.end(), probe) - ids.begin();
+        REQUIRE(index.lower_bound(probe) == static_cast<std::size_t>(expected));
+        REQUIRE_FALSE(index.contains(probe));
+    }
+
+    REQUIRE(index.lower_bound(k_nil) == 0);
+    REQUIRE_FALSE(index.contains(k_nil));
+}
+
+TEST_CASE("Prefix queries", "[sorted_uuid_index]") {
+    std::vector<uuid> ids{
+            make_from("6ba7b810-9dad-11d1-80b4-00c04fd430c8"),
+            make_from("6ba7b811-9dad-11d1-80b4-00c04fd430c8"),
+            make_from("6ba7b812-9dad-11d1-80b4-00c04fd430c8"),
+            make_from("6ba7c000-0000-4000-8000-000000000000"),
+            make_from("ffffffff-ffff-ffff-ffff-ffffffffffff"),
+    };
+    sorted_uuid_index index(ids);
+
+    SECTION("ranges") {
+        auto range = index.prefix_range("6ba7b81");
+        REQUIRE(range);
+        CHECK(range->first == 0);
+        CHECK(range->last == 3);
+
+        CHECK(index.prefix_range("6BA7")->size() == 4);
+        CHECK(index.prefix_range("")->size() == 5);
+        CHECK(index.prefix_range("ff")->first == 4);
+        CHECK(index.prefix_range("ff")->last == 5);
+        CHECK(index.prefix_range("0")->empty());
+        CHECK(index.prefix_range("ffffffff-ffff-ffff-ffff-ffffffffffff")->size() == 1);
+    }
+
+    SECTION("invalid prefixes") {
+        CHECK_FALSE(index.prefix_range("6bx").has_value());
+        CHECK_FALSE(index.prefix_range("ffffffff-ffff-ffff-ffff-ffffffffffff0").has_value());
+    }
+
+    SECTION("resolve") {
+        CHECK(index.resolve("6ba7b811") == ids[1]);
+        CHECK(index.resolve("6ba7-b812-") == ids[2]);
+        CHECK(index.resolve("6ba7c") == ids[3]);
+        CHECK_FALSE(index.resolve("6ba7b81").has_value());
+        CHECK_FALSE(index.resolve("1").has_value());
+    }
+
+    SECTION("shortest unique prefixes") {
+        CHECK(index.unique_prefix_length(0) == 8);
+        CHECK(index.unique_prefix_length(3) == 5);
+        CHECK(index.unique_prefix_length(4) == 1);
+    }
+}
+
+TEST_CASE("Unique prefixes resolve", "[sorted_uuid_index]") {
+    auto gen = GENERATE(test::gen_v1, test::gen_v4);
+    auto ids = test::make_ids(3000, gen);
+    sorted_uuid_index index(ids);
+
+    std::vector<uint8_t> lengths(index.size());
+    index.unique_prefix_lengths(lengths.data());
+    for (std::size_t i = 0; i < index.size(); ++i) {
+        REQUIRE(lengths[i] == index.unique_prefix_length(i));
+
+        const auto digits = hex_digits(index.at(i));
+        REQUIRE(index.resolve(std::string_view(digits).substr(0, lengths[i])) == index.at(i));
+        if (lengths[i] > 1) {
+            REQUIRE(index.prefix_range(std::string_view(digits).substr(0, lengths[i] - 1))
+                            ->size() > 1);
+        }
+    }
+}
+
+} // namespace uuidxx
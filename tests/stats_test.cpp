@@ -0,0 +1,47 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/stats.h"
+#include "uuidxx/uuidxx.h"
+
+#include <numeric>
+
+namespace uuidxx {
+
+TEST_CASE("Generation counters", "[stats]") {
+    reset_stats();
+
+    for (int i = 0; i < 10; ++i) {
+        make_v4();
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        make_v1();
+    }
+
+    auto snapshot = stats();
+    auto histogram_total = std::accumulate(snapshot.latency_histogram.begin(),
+                                           snapshot.latency_histogram.end(), uint64_t{0});
+
+#if UUIDXX_ENABLE_STATS
+    CHECK(snapshot.get(stat_counter::generated_v4) == 10);
+    CHECK(snapshot.get(stat_counter::generated_v1) == 1000);
+#if UUIDXX_ENABLE_LATENCY_HISTOGRAM
+    CHECK(histogram_total == 1010);
+#else
+    CHECK(histogram_total == 0);
+#endif
+#else
+    CHECK(snapshot.get(stat_counter::generated_v4) == 0);
+    CHECK(snapshot.get(stat_counter::generated_v1) == 0);
+    CHECK(histogram_total == 0);
+#endif
+
+    reset_stats();
+    CHECK(stats().get(stat_counter::generated_v4) == 0);
+}
+
+} // namespace uuidxx
@@ -0,0 +1,51 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_TESTS_TEST_UTILS_H_
+#define UUIDXX_TESTS_TEST_UTILS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "uuidxx/uuidxx.h"
+
+namespace uuidxx {
+namespace test {
+
+// Generators as plain functions, to be picked by `GENERATE()`.
+
+inline uuid gen_v1() {
+    return make_v1();
+}
+
+inline uuid gen_v4() {
+    return make_v4();
+}
+
+// Of names "0", "1", and so on.
+inline uuid gen_v5() {
+    static uint64_t n = 0;
+    return make_v5(k_namespace_url, std::to_string(n++));
+}
+
+template<typename Gen>
+std::vector<uuid> make_ids(std::size_t count, Gen gen) {
+    std::vector<uuid> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.push_back(gen());
+    }
+    return ids;
+}
+
+inline std::vector<uuid> make_ids(std::size_t count) {
+    return make_ids(count, gen_v4);
+}
+
+} // namespace test
+} // namespace uuidxx
+
+#endif // UUIDXX_TESTS_TEST_UTILS_H_
@@ -0,0 +1,79 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_column.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+std::vector<uuid> sorted_ids(std::size_t count, uuid (*gen)()) {
+    auto ids = test::make_ids(count, gen);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+} // namespace
+
+TEST_CASE("Empty column", "[uuid_column]") {
+    uuid_column col;
+    REQUIRE(col.empty());
+    REQUIRE(col.begin() == col.end());
+    REQUIRE_FALSE(col.contains(make_v4()));
+}
+
+TEST_CASE("Round trip and lookup", "[uuid_column]") {
+    // Not a multiple of block size, to have a partial block.
+    constexpr std::size_t k_count = uuid_column::k_block_size * 7 + 13;
+
+    auto gen = GENERATE(test::gen_v1, test::gen_v4);
+    auto ids = sorted_ids(k_count, gen);
+    uuid_column col(ids);
+    REQUIRE(col.size() == k_count);
+
+    SECTION("iteration decodes in order") {
+        std::vector<uuid> decoded(col.begin(), col.end());
+        REQUIRE(decoded == ids);
+    }
+
+    SECTION("contains every element") {
+        for (const auto& id : ids) {
+            REQUIRE(col.contains(id));
+        }
+    }
+
+    SECTION("absent elements") {
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE_FALSE(col.contains(make_v4()));
+        }
+        REQUIRE_FALSE(col.contains(k_nil));
+        REQUIRE_FALSE(col.contains(make_from("ffffffff-ffff-ffff-ffff-ffffffffffff")));
+    }
+}
+
+TEST_CASE("Duplicates and extreme deltas", "[uuid_column]") {
+    std::vector<uuid> ids{k_nil, k_nil, make_from("00000000-0000-0000-0000-000000000001"),
+                          make_from("7fffffff-ffff-ffff-0000-000000000000"),
+                          make_from("ffffffff-ffff-ffff-ffff-ffffffffffff")};
+    uuid_column col(ids);
+    std::vector<uuid> decoded(col.begin(), col.end());
+    REQUIRE(decoded == ids);
+    REQUIRE(col.contains(make_from("7fffffff-ffff-ffff-0000-000000000000")));
+    REQUIRE_FALSE(col.contains(make_from("7fffffff-ffff-ffff-0000-000000000001")));
+}
+
+TEST_CASE("Time-based ids are compressed", "[uuid_column]") {
+    constexpr std::size_t k_count = 10000;
+    auto ids = sorted_ids(k_count, test::gen_v1);
+    uuid_column col(ids);
+    REQUIRE(col.memory_usage() * 2 < k_count * sizeof(uuid));
+}
+
+} // namespace uuidxx
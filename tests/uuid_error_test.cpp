@@ -0,0 +1,94 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuidxx.h"
+
+#include <array>
+#include <string>
+#include <system_error>
+
+namespace uuidxx {
+
+static_assert(noexcept(make_from(std::string_view{}, std::declval<std::error_code&>())));
+static_assert(noexcept(make_from_bytes(nullptr, 0, std::declval<std::error_code&>())));
+static_assert(noexcept(make_v3(k_nil, std::string_view{}, std::declval<std::error_code&>())));
+static_assert(noexcept(make_v5(k_nil, std::string_view{}, std::declval<std::error_code&>())));
+
+TEST_CASE("Error codes", "[uuid_error]") {
+    std::error_code ec = uuid_errc::invalid_digit;
+    CHECK(ec);
+    CHECK(ec.category() == uuid_category());
+    CHECK(std::string(ec.category().name()) == "uuidxx");
+    CHECK(ec.message() == "invalid hexadecimal digit in uuid");
+    CHECK(ec == uuid_errc::invalid_digit);
+    CHECK(ec != uuid_errc::invalid_length);
+}
+
+TEST_CASE("Parse without exceptions", "[uuid_error]") {
+    const std::string text("6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+    std::error_code ec = uuid_errc::invalid_format;
+
+    SECTION("valid strings clear the error") {
+        auto id = make_from(text, ec);
+        CHECK_FALSE(ec);
+        CHECK(id == k_namespace_dns);
+
+        CHECK(make_from("{6BA7B810-9DAD-11D1-80B4-00C04FD430C8}", ec) == k_namespace_dns);
+        CHECK_FALSE(ec);
+    }
+
+    SECTION("invalid strings") {
+        auto check_error = [&ec](std::string_view src, uuid_errc expected) {
+            CHECK(make_from(src, ec) == k_nil);
+            CHECK(ec == expected);
+        };
+
+        check_error("", uuid_errc::invalid_length);
+        check_error(text.substr(1), uuid_errc::invalid_length);
+        check_error(text + "0", uuid_errc::invalid_length);
+        check_error("[" + text + "]", uuid_errc::invalid_format);
+        check_error("6ba7b8101-dad-11d1-80b4-00c04fd430c8", uuid_errc::invalid_format);
+        check_error("6ba7b810-9dad-11d1-80b4-00c04fd430cz", uuid_errc::invalid_digit);
+        check_error("+ba7b810-9dad-11d1-80b4-00c04fd430c8", uuid_errc::invalid_digit);
+
+        // Used to be parsed up to the bad digit.
+        check_error("6ba7b8z0-9dad-11d1-80b4-00c04fd430c8", uuid_errc::invalid_digit);
+    }
+}
+
+TEST_CASE("From bytes", "[uuid_error]") {
+    constexpr std::array<uint8_t, 16> bytes{0x6b, 0xa7, 0xb8, 0x10, 0x9d, 0xad, 0x11, 0xd1,
+                                            0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8};
+    std::error_code ec;
+    CHECK(make_from_bytes(bytes.data(), bytes.size(), ec) == k_namespace_dns);
+    CHECK_FALSE(ec);
+
+    CHECK(make_from_bytes(bytes.data(), bytes.size() - 1, ec) == k_nil);
+    CHECK(ec == uuid_errc::invalid_length);
+}
+
+TEST_CASE("Name-based uuids with size limits", "[uuid_error]") {
+    std::error_code ec;
+    CHECK(make_v3(k_namespace_url, "www.example.com", ec) ==
+          make_v3(k_namespace_url, "www.example.com"));
+    CHECK_FALSE(ec);
+    CHECK(make_v5(k_namespace_url, "www.example.com", ec) ==
+          make_v5(k_namespace_url, "www.example.com"));
+    CHECK_FALSE(ec);
+
+    const std::string name(k_default_max_name_size + 1, 'x');
+    CHECK(make_v5(k_namespace_url, name, ec) == k_nil);
+    CHECK(ec == uuid_errc::name_too_long);
+
+    CHECK(make_v3(k_namespace_url, "www.example.com", ec, 4) == k_nil);
+    CHECK(ec == uuid_errc::name_too_long);
+
+    CHECK(make_v5(k_namespace_url, "www.example.com", ec, 15) ==
+          make_v5(k_namespace_url, "www.example.com"));
+    CHECK_FALSE(ec);
+}
+
+} // namespace uuidxx
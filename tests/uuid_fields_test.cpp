@@ -0,0 +1,110 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_fields.h"
+#include "uuidxx/uuidxx.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+// 2022-02-22 19:22:22 GMT-05:00, the time of test vectors of RFC 9562.
+constexpr int64_t k_rfc_vector_unix_ms = 1645557742000;
+
+uuid_timestamp from_unix_ms(int64_t ms) {
+    return uuid_timestamp(std::chrono::milliseconds(ms));
+}
+
+} // namespace
+
+TEST_CASE("Variant and validity", "[fields]") {
+    CHECK(make_v4().variant() == uuid_variant::rfc4122);
+    CHECK(make_v4().is_valid_rfc());
+    CHECK(make_v1().is_valid_rfc());
+
+    CHECK(k_nil.variant() == uuid_variant::ncs);
+    CHECK_FALSE(k_nil.is_valid_rfc());
+
+    CHECK(make_from("00000000-0000-4000-c000-000000000000").variant() == uuid_variant::microsoft);
+    CHECK(make_from("00000000-0000-4000-e000-000000000000").variant() == uuid_variant::future);
+    CHECK_FALSE(make_from("00000000-0000-9000-8000-000000000000").is_valid_rfc());
+}
+
+TEST_CASE("Timestamps of RFC 9562 test vectors", "[fields]") {
+    auto expected = from_unix_ms(k_rfc_vector_unix_ms);
+
+    SECTION("v1") {
+        auto id = make_from("c232ab00-9414-11ec-b3c8-9f6bdeced846");
+        CHECK(id.timestamp() == expected);
+        CHECK(id.clock_seq() == 0x33c8);
+        CHECK(id.node() == node_id{std::byte{0x9f}, std::byte{0x6b}, std::byte{0xde},
+                                   std::byte{0xce}, std::byte{0xd8}, std::byte{0x46}});
+    }
+
+    SECTION("v6") {
+        auto id = make_from("1ec9414c-232a-6b00-b3c8-9f6bdeced846");
+        CHECK(id.version() == version::v6);
+        CHECK(id.timestamp() == expected);
+        CHECK(id.clock_seq() == 0x33c8);
+    }
+
+    SECTION("v7") {
+        auto id = make_from("017f22e2-79b0-7cc3-98c4-dc0c0c07398f");
+        CHECK(id.version() == version::v7);
+        CHECK(id.timestamp() == expected);
+        CHECK(id.clock_seq() == 0);
+    }
+
+    SECTION("no timestamp") {
+        CHECK(make_v4().timestamp().time_since_epoch().count() == 0);
+        CHECK(make_v5(k_namespace_dns, "a").timestamp().time_since_epoch().count() == 0);
+    }
+}
+
+TEST_CASE("Fields of generated ids", "[fields]") {
+    auto before = std::chrono::system_clock::now();
+    auto id = make_v1();
+    auto after = std::chrono::system_clock::now();
+
+    CHECK(id.timestamp() >= std::chrono::time_point_cast<uuid_timestamp::duration>(before));
+    CHECK(id.timestamp() <= std::chrono::time_point_cast<uuid_timestamp::duration>(after));
+
+    node_id node;
+    read_mac_addr_as_node_id(node);
+    CHECK(id.node() == node);
+
+    auto str = id.to_string();
+    CHECK(id.clock_seq() == (std::stoul(str.substr(19, 4), nullptr, 16) & 0x3fff));
+
+    auto v2 = make_v2(make_person_host());
+    CHECK(v2.node() == node);
+    auto v2_delta = v2.timestamp() - id.timestamp();
+    CHECK(v2_delta < std::chrono::minutes(8));
+    CHECK(v2_delta > -std::chrono::minutes(8));
+}
+
+TEST_CASE("Bulk timestamp extraction", "[fields]") {
+    std::vector<uuid> ids;
+    for (int i = 0; i < 37; ++i) {
+        ids.push_back(make_v1());
+        ids.push_back(make_v4());
+        ids.push_back(make_v2(make_group_host()));
+        ids.push_back(make_from("1ec9414c-232a-6b00-b3c8-9f6bdeced846"));
+        ids.push_back(make_from("017f22e2-79b0-7cc3-98c4-dc0c0c07398f"));
+    }
+
+    std::vector<uuid_timestamp> out(ids.size());
+    extract_timestamps(ids.data(), ids.size(), out.data());
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(out[i] == ids[i].timestamp());
+    }
+}
+
+} // namespace uuidxx
@@ -0,0 +1,159 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_file.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+std::string temp_file_path(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+std::vector<uuid> make_sorted_ids(std::size_t count) {
+    auto ids = test::make_ids(count);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+} // namespace
+
+TEST_CASE("Records are in canonical byte order", "[uuid_file]") {
+    const auto id = make_from("6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+    const auto rec = uuid_record::from_uuid(id);
+    CHECK(rec.bytes[0] == 0x6b);
+    CHECK(rec.bytes[15] == 0xc8);
+    CHECK(rec.to_uuid() == id);
+    CHECK(rec == id);
+    CHECK(uuid_record::from_uuid(k_nil) < rec);
+}
+
+TEST_CASE("Write and read back", "[uuid_file]") {
+    auto path = temp_file_path("uuidxx_uuid_file_test");
+    auto stride = GENERATE(as<std::size_t>{}, 0, 1, 7, 1024);
+    auto ids = make_sorted_ids(5000);
+
+    // Duplicates and order don't matter.
+    auto input = ids;
+    input.insert(input.end(), ids.begin(), ids.begin() + 10);
+    std::reverse(input.begin(), input.end());
+    REQUIRE(write_uuid_file(path, input.data(), input.size(), stride));
+    REQUIRE_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    uuid_file_reader reader;
+    REQUIRE(reader.open(path));
+    REQUIRE(reader.size() == ids.size());
+    REQUIRE(reader.verify());
+
+    SECTION("iteration") {
+        REQUIRE(std::equal(reader.begin(), reader.end(), ids.begin(), ids.end(),
+                           [](const uuid_record& rec, const uuid& id) { return rec == id; }));
+    }
+
+    SECTION("lookups") {
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            REQUIRE(reader.find(ids[i]) == i);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            auto probe = make_v4();
+            auto expected = std::lower_bound(ids.begin(), ids.end(), probe) - ids.begin();
+            REQUIRE(reader.lower_bound(probe) == static_cast<std::size_t>(expected));
+            REQUIRE_FALSE(reader.contains(probe));
+        }
+    }
+
+    reader.close();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Records sharing high words", "[uuid_file]") {
+    auto path = temp_file_path("uuidxx_uuid_file_test_hi");
+    std::vector<uuid> ids;
+    for (uint64_t hi = 0; hi < 10; ++hi) {
+        for (uint64_t lo = 0; lo < 100; ++lo) {
+            ids.push_back(make_from_raw_data({hi * 1000, lo * 2}));
+        }
+    }
+    REQUIRE(write_uuid_file(path, ids.data(), ids.size(), 16));
+
+    uuid_file_reader reader;
+    REQUIRE(reader.open(path));
+    for (uint64_t hi = 0; hi < 10; ++hi) {
+        for (uint64_t lo = 0; lo < 200; ++lo) {
+            auto pos = reader.lower_bound(make_from_raw_data({hi * 1000, lo}));
+            REQUIRE(pos == hi * 100 + (lo + 1) / 2);
+        }
+    }
+
+    reader.close();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Empty file", "[uuid_file]") {
+    auto path = temp_file_path("uuidxx_uuid_file_test_empty");
+    REQUIRE(write_uuid_file(path, nullptr, 0));
+
+    uuid_file_reader reader;
+    REQUIRE(reader.open(path));
+    CHECK(reader.empty());
+    CHECK(reader.begin() == reader.end());
+    CHECK_FALSE(reader.contains(k_nil));
+
+    reader.close();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Writer rejects unordered ids", "[uuid_file]") {
+    auto path = temp_file_path("uuidxx_uuid_file_test_order");
+    auto ids = make_sorted_ids(2);
+
+    uuid_file_writer writer;
+    REQUIRE(writer.open(path));
+    REQUIRE(writer.append(ids[1]));
+    REQUIRE_FALSE(writer.append(ids[0]));
+    REQUIRE_FALSE(writer.append(ids[1]));
+    writer.abort();
+    CHECK_FALSE(std::filesystem::exists(path));
+    CHECK_FALSE(std::filesystem::exists(path + ".tmp"));
+}
+
+TEST_CASE("Reader rejects malformed files", "[uuid_file]") {
+    auto path = temp_file_path("uuidxx_uuid_file_test_bad");
+    uuid_file_reader reader;
+
+    SECTION("missing") {
+        CHECK_FALSE(reader.open(path));
+    }
+
+    SECTION("not a uuid file") {
+        std::ofstream(path, std::ios::binary) << std::string(100, 'x');
+        CHECK_FALSE(reader.open(path));
+    }
+
+    SECTION("truncated") {
+        auto ids = make_sorted_ids(100);
+        REQUIRE(write_uuid_file(path, ids.data(), ids.size()));
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 9);
+        CHECK_FALSE(reader.open(path));
+    }
+
+    CHECK_FALSE(reader.is_open());
+    std::filesystem::remove(path);
+}
+
+} // namespace uuidxx
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_filter.h"
+#include "uuidxx/uuidxx.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uuidxx {
+
+TEST_CASE("No false negatives", "[uuid_filter]") {
+    std::vector<uuid> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids.push_back(make_v4());
+        ids.push_back(make_v1());
+        ids.push_back(make_v5(k_namespace_dns, std::to_string(i)));
+    }
+
+    uuid_filter filter(ids.size());
+    for (const auto& id : ids) {
+        filter.insert(id);
+    }
+
+    for (const auto& id : ids) {
+        REQUIRE(filter.maybe_contains(id));
+    }
+}
+
+TEST_CASE("Bulk operations agree with single ones", "[uuid_filter]") {
+    constexpr std::size_t k_count = 5000;
+    std::vector<uuid> ids;
+    for (std::size_t i = 0; i < k_count; ++i) {
+        ids.push_back(make_v4());
+    }
+
+    uuid_filter filter(k_count);
+    filter.insert_many(ids.data(), k_count / 2);
+
+    std::unique_ptr<bool[]> results(new bool[k_count]);
+    auto hits = filter.maybe_contains_many(ids.data(), k_count, results.get());
+
+    std::size_t expected_hits = 0;
+    for (std::size_t i = 0; i < k_count; ++i) {
+        REQUIRE(results[i] == filter.maybe_contains(ids[i]));
+        if (i < k_count / 2) {
+            REQUIRE(results[i]);
+        }
+        expected_hits += results[i];
+    }
+    REQUIRE(hits == expected_hits);
+}
+
+TEST_CASE("False positive rate is bounded", "[uuid_filter]") {
+    constexpr std::size_t k_count = 10000;
+    constexpr std::size_t k_probes = 100000;
+
+    auto gen = GENERATE(as<uuid (*)()>{}, [] { return make_v4(); }, [] { return make_v1(); });
+
+    uuid_filter filter(k_count);
+    for (std::size_t i = 0; i < k_count; ++i) {
+        filter.insert(gen());
+    }
+
+    std::size_t false_positives = 0;
+    for (std::size_t i = 0; i < k_probes; ++i) {
+        false_positives += filter.maybe_contains(gen());
+    }
+
+    // Expected to be around 0.5%.
+    REQUIRE(false_positives < k_probes / 50);
+}
+
+TEST_CASE("Clear filter", "[uuid_filter]") {
+    uuid_filter filter(100);
+    auto id = make_v4();
+    filter.insert(id);
+    REQUIRE(filter.maybe_contains(id));
+    filter.clear();
+    REQUIRE_FALSE(filter.maybe_contains(id));
+}
+
+} // namespace uuidxx
@@ -0,0 +1,105 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_hll.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <vector>
+
+namespace uuidxx {
+
+TEST_CASE("Empty sketch", "[uuid_hll]") {
+    uuid_hll hll;
+    CHECK(hll.precision() == uuid_hll::k_default_precision);
+    CHECK(hll.memory_usage() == 1U << uuid_hll::k_default_precision);
+    CHECK(hll.estimate() == 0.0);
+    CHECK(uuid_hll(1).precision() == uuid_hll::k_min_precision);
+    CHECK(uuid_hll(30).precision() == uuid_hll::k_max_precision);
+}
+
+TEST_CASE("Estimates are within error bounds", "[uuid_hll]") {
+    auto gen = GENERATE(test::gen_v1, test::gen_v4, test::gen_v5);
+    auto count = GENERATE(as<std::size_t>{}, 10, 1000, 200000);
+    auto ids = test::make_ids(count, gen);
+
+    uuid_hll hll;
+    hll.add_many(ids.data(), ids.size());
+
+    // About 5 standard errors; small counts lose an id to each pair sharing a register,
+    // which happens to a few runs in a thousand.
+    const auto expected = Approx(static_cast<double>(count)).epsilon(0.04).margin(2.0);
+    CHECK(hll.estimate() == expected);
+
+    // Duplicates don't count.
+    for (const auto& id : ids) {
+        hll.add(id);
+    }
+    CHECK(hll.estimate() == expected);
+}
+
+TEST_CASE("Add and add_many agree", "[uuid_hll]") {
+    auto ids = test::make_ids(5000, test::gen_v1);
+    uuid_hll one;
+    for (const auto& id : ids) {
+        one.add(id);
+    }
+
+    uuid_hll many;
+    many.add_many(ids.data(), ids.size());
+    CHECK(one.serialize() == many.serialize());
+}
+
+TEST_CASE("Merged sketch equals sketch of the union", "[uuid_hll]") {
+    auto precision = GENERATE(uuid_hll::k_min_precision, 10, uuid_hll::k_max_precision);
+    auto a = test::make_ids(30000, test::gen_v4);
+    auto b = test::make_ids(20000, test::gen_v4);
+
+    uuid_hll whole(precision);
+    whole.add_many(a.data(), a.size());
+    whole.add_many(b.data(), b.size());
+
+    uuid_hll left(precision);
+    uuid_hll right(precision);
+    left.add_many(a.data(), a.size());
+    right.add_many(b.data(), b.size());
+    REQUIRE(left.merge(right));
+    CHECK(left.serialize() == whole.serialize());
+
+    CHECK_FALSE(left.merge(uuid_hll(precision == 10 ? 11 : 10)));
+}
+
+TEST_CASE("Serialization round trip", "[uuid_hll]") {
+    auto precision = GENERATE(uuid_hll::k_min_precision, uuid_hll::k_default_precision);
+    auto ids = test::make_ids(50000, test::gen_v4);
+    uuid_hll hll(precision);
+    hll.add_many(ids.data(), ids.size());
+
+    const auto bytes = hll.serialize();
+    CHECK(bytes.size() == 2 + hll.memory_usage() * 3 / 4);
+
+    auto restored = uuid_hll::deserialize(bytes.data(), bytes.size());
+    REQUIRE(restored);
+    CHECK(restored->precision() == precision);
+    CHECK(restored->estimate() == hll.estimate());
+    CHECK(restored->serialize() == bytes);
+
+    SECTION("malformed input") {
+        CHECK_FALSE(uuid_hll::deserialize(bytes.data(), bytes.size() - 1));
+        CHECK_FALSE(uuid_hll::deserialize(bytes.data(), 1));
+
+        auto bad = bytes;
+        bad[0] = 0xff;
+        CHECK_FALSE(uuid_hll::deserialize(bad.data(), bad.size()));
+
+        bad = bytes;
+        bad[2] = 0xff;
+        CHECK_FALSE(uuid_hll::deserialize(bad.data(), bad.size()));
+    }
+}
+
+} // namespace uuidxx
@@ -0,0 +1,113 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_interner.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+// Half random, and half time-based.
+std::vector<uuid> make_ids(std::size_t count) {
+    return test::make_ids(count,
+                          [i = 0]() mutable { return i++ % 2 == 0 ? make_v4() : make_v1(); });
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Intern and look up", "[interner]", uint32_t, uint64_t) {
+    basic_uuid_interner<TestType> interner;
+    auto ids = make_ids(20000);
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(interner.intern(ids[i]) == i);
+    }
+
+    // Interning again is idempotent.
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(interner.intern(ids[i]) == i);
+        REQUIRE(interner.find(ids[i]) == static_cast<TestType>(i));
+        REQUIRE(interner.lookup(static_cast<TestType>(i)) == ids[i]);
+    }
+
+    CHECK(interner.size() == ids.size());
+    CHECK_FALSE(interner.find(make_v4()).has_value());
+    CHECK(interner.memory_usage() >= ids.size() * sizeof(uuid::data));
+}
+
+TEST_CASE("Bulk interning", "[interner]") {
+    uuid_interner interner;
+    auto ids = make_ids(5000);
+    // With duplicates.
+    auto more = ids;
+    more.insert(more.end(), ids.begin(), ids.begin() + 1000);
+
+    std::vector<uint32_t> keys(more.size());
+    interner.intern_many(more.data(), more.size(), keys.data());
+    CHECK(interner.size() == ids.size());
+
+    std::vector<uuid> back(more.size(), k_nil);
+    interner.lookup_many(keys.data(), keys.size(), back.data());
+    CHECK(back == more);
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(interner.intern(ids[i]) == keys[i]);
+        REQUIRE(keys[ids.size() + i % 1000] == keys[i % 1000]);
+    }
+
+    std::unordered_set<uint32_t> distinct(keys.begin(), keys.end());
+    CHECK(distinct.size() == ids.size());
+    CHECK(*std::max_element(keys.begin(), keys.end()) == ids.size() - 1);
+}
+
+TEST_CASE("Concurrent interning", "[interner]") {
+    constexpr int k_threads = 4;
+    uuid_interner interner;
+    auto ids = make_ids(50000);
+
+    std::vector<std::vector<uint32_t>> keys(k_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t) {
+        threads.emplace_back([&, t] {
+            // Every thread interns all ids, starting at different positions.
+            auto& out = keys[t];
+            out.resize(ids.size());
+            auto start = ids.size() * t / k_threads;
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                auto idx = (start + i) % ids.size();
+                out[idx] = interner.intern(ids[idx]);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    CHECK(interner.size() == ids.size());
+    for (int t = 1; t < k_threads; ++t) {
+        REQUIRE(keys[t] == keys[0]);
+    }
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(interner.lookup(keys[0][i]) == ids[i]);
+    }
+}
+
+TEST_CASE("Hash of uuid", "[interner]") {
+    auto id = make_v4();
+    CHECK(std::hash<uuid>{}(id) == std::hash<uuid>{}(make_from(id.to_string())));
+    CHECK(std::hash<uuid>{}(id) != std::hash<uuid>{}(make_v4()));
+}
+
+} // namespace uuidxx
@@ -0,0 +1,105 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_partition.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+// Checks that `out` holds ids of each shard in their input order, which also makes it a
+// permutation of `ids`.
+template<typename ShardFn>
+void check_partition(const std::vector<uuid>& ids, const uuid* out, uint32_t shards,
+                     const std::vector<std::size_t>& bounds, ShardFn shard_of) {
+    REQUIRE(bounds.size() == shards + 1);
+    REQUIRE(bounds.front() == 0);
+    REQUIRE(bounds.back() == ids.size());
+
+    auto cursors = bounds;
+    for (const auto& id : ids) {
+        const auto s = shard_of(id, shards);
+        REQUIRE(s < shards);
+        REQUIRE(cursors[s] < bounds[s + 1]);
+        REQUIRE(out[cursors[s]++] == id);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Shard functions", "[uuid_partition]") {
+    const auto ids = test::make_ids(20000);
+
+    SECTION("high bits are spread evenly") {
+        std::vector<std::size_t> counts(16, 0);
+        for (const auto& id : ids) {
+            ++counts[high_bits_shard{}(id, 16)];
+        }
+        for (auto n : counts) {
+            CHECK(n == Approx(20000.0 / 16).epsilon(0.2));
+        }
+    }
+
+    SECTION("jump consistent hash moves ids only to the new shard") {
+        for (uint32_t shards = 1; shards < 40; ++shards) {
+            for (const auto& id : ids) {
+                const auto before = jump_consistent_shard{}(id, shards);
+                const auto after = jump_consistent_shard{}(id, shards + 1);
+                REQUIRE(before < shards);
+                REQUIRE((after == before || after == shards));
+            }
+        }
+    }
+}
+
+TEST_CASE("Partition is stable and complete", "[uuid_partition]") {
+    auto shards = GENERATE(as<uint32_t>{}, 1, 3, 64, 1000);
+    auto count = GENERATE(as<std::size_t>{}, 0, 1, 7, 10000);
+    const auto ids = test::make_ids(count);
+
+    // Offsets the output from cache lines to cover partially filled lines.
+    auto skew = GENERATE(as<std::size_t>{}, 0, 1, 3);
+    std::vector<uuid> buf(count + skew, k_nil);
+    auto* out = buf.data() + skew;
+
+    SECTION("jump consistent hash") {
+        auto bounds = partition(ids.data(), ids.size(), shards, out);
+        check_partition(ids, out, shards, bounds, jump_consistent_shard{});
+    }
+
+    SECTION("high bits") {
+        auto bounds = partition(ids.data(), ids.size(), shards, out, high_bits_shard{});
+        check_partition(ids, out, shards, bounds, high_bits_shard{});
+    }
+}
+
+TEST_CASE("Partition with threads and streaming stores", "[uuid_partition]") {
+    // Large enough to bypass the cache.
+    constexpr std::size_t count = details::k_streaming_threshold / sizeof(uuid) + 123;
+    const auto ids = test::make_ids(count);
+    std::vector<uuid> out(count, k_nil);
+
+    partition_options opts;
+    opts.threads = GENERATE(as<std::size_t>{}, 1, 4);
+    opts.min_ids_per_thread = 1000;
+
+    auto bounds = partition(ids.data(), ids.size(), 257, out.data(), high_bits_shard{}, opts);
+    check_partition(ids, out.data(), 257, bounds, high_bits_shard{});
+}
+
+TEST_CASE("Partition into no shards", "[uuid_partition]") {
+    const auto ids = test::make_ids(10);
+    std::vector<uuid> out(10, k_nil);
+    CHECK(partition(ids.data(), ids.size(), 0, out.data()).empty());
+    CHECK(std::all_of(out.begin(), out.end(), [](const uuid& id) { return id == k_nil; }));
+}
+
+} // namespace uuidxx
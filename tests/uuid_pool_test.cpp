@@ -0,0 +1,113 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uuidxx {
+
+TEST_CASE("Pool is prefilled on construction", "[uuid_pool]") {
+    uuid_pool pool(uuid_pool_options{64, 16, 0, true, {}});
+    REQUIRE(pool.capacity() == 64);
+    REQUIRE(pool.available() == 64);
+
+    auto id = pool.try_take();
+    REQUIRE(id.has_value());
+    REQUIRE(id->version() == version::v4);
+    REQUIRE(pool.fallback_count() == 0);
+}
+
+TEST_CASE("Capacity is rounded up to power of 2", "[uuid_pool]") {
+    uuid_pool pool(uuid_pool_options{100, 16, 0, true, {}});
+    REQUIRE(pool.capacity() == 128);
+}
+
+TEST_CASE("Custom generator and high watermark", "[uuid_pool]") {
+    uuid_pool_options opts;
+    opts.capacity = 32;
+    opts.low_watermark = 4;
+    opts.high_watermark = 8;
+    opts.generator = [] { return make_v1(); };
+
+    uuid_pool pool(opts);
+    REQUIRE(pool.available() == 8);
+    REQUIRE(pool.take().version() == version::v1);
+}
+
+TEST_CASE("Fallback to inline generation when drained", "[uuid_pool]") {
+    // The refill thread blocks until released, thus can't keep up with takes; prefilling
+    // and fallbacks run on this thread.
+    const auto this_id = std::this_thread::get_id();
+    std::atomic<bool> released{false};
+    std::atomic<int> calls{0};
+    uuid_pool_options opts;
+    opts.capacity = 4;
+    opts.low_watermark = 0;
+    opts.high_watermark = 2;
+    opts.generator = [this_id, &released, &calls] {
+        while (std::this_thread::get_id() != this_id &&
+               !released.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        ++calls;
+        return make_v4();
+    };
+
+    uuid_pool pool(opts);
+
+    // Destroyed before the pool, which joins the refill thread.
+    struct releaser {
+        std::atomic<bool>& released;
+
+        ~releaser() {
+            released.store(true, std::memory_order_release);
+        }
+    };
+    const releaser release{released};
+
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(pool.take().version() == version::v4);
+    }
+
+    REQUIRE(pool.fallback_count() == 98);
+    REQUIRE(calls.load() == 100);
+}
+
+TEST_CASE("Concurrent takes yield unique ids", "[uuid_pool]") {
+    uuid_pool pool(uuid_pool_options{256, 64, 0, true, {}});
+
+    constexpr int k_threads = 4;
+    constexpr int k_per_thread = 2000;
+    std::vector<std::vector<std::string>> results(k_threads);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < k_threads; ++i) {
+        workers.emplace_back([&pool, &ids = results[i]] {
+            for (int n = 0; n < k_per_thread; ++n) {
+                ids.push_back(pool.take().to_string());
+            }
+        });
+    }
+
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    std::vector<std::string> all;
+    for (auto& ids : results) {
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+
+    REQUIRE(all.size() == k_threads * k_per_thread);
+    std::sort(all.begin(), all.end());
+    REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+} // namespace uuidxx
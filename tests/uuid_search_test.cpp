@@ -0,0 +1,130 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_search.h"
+#include "uuidxx/uuidxx.h"
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace uuidxx {
+namespace {
+
+struct search_kernel {
+    const char* name;
+    std::size_t (*find)(const uuid*, std::size_t, const uuid&) noexcept;
+    std::size_t (*count_equal)(const uuid*, std::size_t, const uuid&) noexcept;
+};
+
+// Those the cpu supports; the public functions pick only the widest of them.
+std::vector<search_kernel> supported_kernels() {
+    std::vector<search_kernel> kernels{
+            {"scalar", details::find_scalar, details::count_equal_scalar}};
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        kernels.push_back({"avx2", details::find_avx2, details::count_equal_avx2});
+    }
+    if (details::cpu_has_avx512()) {
+        kernels.push_back({"avx512", details::find_avx512, details::count_equal_avx512});
+    }
+#endif
+    return kernels;
+}
+
+} // namespace
+
+TEST_CASE("Find and count in arrays of any length", "[uuid_search]") {
+    // Lengths around vector widths, to exercise tails.
+    for (std::size_t count = 0; count <= 40; ++count) {
+        auto ids = test::make_ids(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(find(ids.data(), count, ids[i]) == i);
+            REQUIRE(count_equal(ids.data(), count, ids[i]) == 1);
+        }
+
+        const auto absent = make_v4();
+        REQUIRE(find(ids.data(), count, absent) == count);
+        REQUIRE(count_equal(ids.data(), count, absent) == 0);
+        REQUIRE(find(ids.data(), count, k_nil) == count);
+    }
+}
+
+TEST_CASE("Each kernel finds and counts in arrays of any length", "[uuid_search]") {
+    for (const auto& kernel : supported_kernels()) {
+        INFO("kernel " << kernel.name);
+        for (std::size_t count = 0; count <= 40; ++count) {
+            auto ids = test::make_ids(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                REQUIRE(kernel.find(ids.data(), count, ids[i]) == i);
+                REQUIRE(kernel.count_equal(ids.data(), count, ids[i]) == 1);
+            }
+
+            const auto absent = make_v4();
+            REQUIRE(kernel.find(ids.data(), count, absent) == count);
+            REQUIRE(kernel.count_equal(ids.data(), count, absent) == 0);
+
+            if (count > 1) {
+                ids[count - 1] = ids[0];
+                REQUIRE(kernel.find(ids.data(), count, ids[0]) == 0);
+                REQUIRE(kernel.count_equal(ids.data(), count, ids[0]) == 2);
+            }
+        }
+    }
+}
+
+TEST_CASE("Halves of an id don't match on their own", "[uuid_search]") {
+    const auto id = make_v4();
+    const auto& raw = id.raw_data();
+
+    // The low word of one id followed by the high word of the next reads as `id`, if
+    // ids were compared at odd lanes.
+    std::vector<uuid> ids{make_from_raw_data({0, raw[0]}), make_from_raw_data({raw[1], 0}),
+                          make_from_raw_data({raw[0], 0}), make_from_raw_data({0, raw[1]})};
+    for (int i = 0; i < 20; ++i) {
+        ids.push_back(ids[static_cast<std::size_t>(i) % 4]);
+    }
+
+    REQUIRE(find(ids.data(), ids.size(), id) == ids.size());
+    REQUIRE(count_equal(ids.data(), ids.size(), id) == 0);
+    REQUIRE_FALSE(any_of_many(ids.data(), ids.size(), &id, 1));
+
+    for (const auto& kernel : supported_kernels()) {
+        INFO("kernel " << kernel.name);
+        REQUIRE(kernel.find(ids.data(), ids.size(), id) == ids.size());
+        REQUIRE(kernel.count_equal(ids.data(), ids.size(), id) == 0);
+    }
+}
+
+TEST_CASE("Find returns the first match, and all are counted", "[uuid_search]") {
+    auto ids = test::make_ids(100);
+    const auto dup = ids[37];
+    ids[61] = dup;
+    ids[99] = dup;
+
+    CHECK(find(ids.data(), ids.size(), dup) == 37);
+    CHECK(count_equal(ids.data(), ids.size(), dup) == 3);
+    CHECK(count_equal(ids.data() + 38, ids.size() - 38, dup) == 2);
+}
+
+TEST_CASE("Any of many", "[uuid_search]") {
+    for (std::size_t count : {0, 1, 7, 8, 15, 16, 17, 100}) {
+        auto ids = test::make_ids(count);
+        auto needles = test::make_ids(5);
+        REQUIRE_FALSE(any_of_many(ids.data(), count, needles.data(), needles.size()));
+        REQUIRE_FALSE(any_of_many(ids.data(), count, needles.data(), 0));
+
+        if (count > 0) {
+            needles[3] = ids[count - 1];
+            REQUIRE(any_of_many(ids.data(), count, needles.data(), needles.size()));
+            needles[3] = ids[count / 2];
+            REQUIRE(any_of_many(ids.data(), count, needles.data(), needles.size()));
+        }
+    }
+}
+
+} // namespace uuidxx
@@ -89,6 +89,57 @@ TEST_CASE("V1 Uniqueness and validation", "[v1]") {
     }
 }
 
+TEST_CASE("Parse node options", "[node]") {
+    node_options opts;
+
+    SECTION("named sources") {
+        REQUIRE(parse_node_options("random", opts));
+        CHECK(opts.source == node_source::random);
+        REQUIRE(parse_node_options("machine-id", opts));
+        CHECK(opts.source == node_source::machine_id);
+        REQUIRE(parse_node_options("system", opts));
+        CHECK(opts.source == node_source::system);
+    }
+
+    SECTION("interface") {
+        REQUIRE(parse_node_options("if:eth0", opts));
+        CHECK(opts.source == node_source::interface);
+        CHECK(opts.interface == "eth0");
+        CHECK_FALSE(parse_node_options("if:", opts));
+    }
+
+    SECTION("explicit node id") {
+        REQUIRE(parse_node_options("00:c0:4F:d4:30:c8", opts));
+        CHECK(opts.source == node_source::explicit_id);
+        CHECK(opts.id == node_id{std::byte{0x00}, std::byte{0xc0}, std::byte{0x4f},
+                                 std::byte{0xd4}, std::byte{0x30}, std::byte{0xc8}});
+
+        REQUIRE(parse_node_options("00-c0-4f-d4-30-c8", opts));
+        CHECK(opts.source == node_source::explicit_id);
+    }
+
+    SECTION("malformed") {
+        CHECK_FALSE(parse_node_options("", opts));
+        CHECK_FALSE(parse_node_options("00:c0:4f:d4:30", opts));
+        CHECK_FALSE(parse_node_options("00:c0-4f:d4:30:c8", opts));
+        CHECK_FALSE(parse_node_options("00:c0:4f:d4:30:cz", opts));
+    }
+}
+
+TEST_CASE("Node options are fixed once resolved", "[node]") {
+    warm_up();
+
+    node_options opts;
+    opts.source = node_source::random;
+    REQUIRE_FALSE(set_node_options(opts));
+
+    node_id first;
+    node_id second;
+    read_mac_addr_as_node_id(first);
+    read_mac_addr_as_node_id(second);
+    REQUIRE(first == second);
+}
+
 TEST_CASE("V2 generation and validation", "[v2]") {
     std::vector<std::string> ids;
     for (int i = 0; i < 10; ++i) {
@@ -148,6 +199,29 @@ TEST_CASE("V5 Generation", "[v5]") {
     REQUIRE(id.to_string() == "21f7f8de-8051-5b89-8680-0195ef798b6a");
 }
 
+TEST_CASE("V5 of names spanning multiple blocks", "[v5]") {
+    // Names of 112 bytes or more are hashed straight from the caller's buffer.
+    const std::string name(200, 'x');
+
+    SECTION("read-only names") {
+        static const char k_name[] =
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
+        REQUIRE(std::string_view(k_name) == name);
+        CHECK(make_v5(k_namespace_dns, k_name).to_string() ==
+              "ddcc691a-b8e2-53e5-b059-6a232874b2eb");
+    }
+
+    SECTION("names are left intact") {
+        auto buf = name;
+        auto id = make_v5(k_namespace_dns, buf);
+        CHECK(buf == name);
+        CHECK(make_v5(k_namespace_dns, buf) == id);
+    }
+}
+
 TEST_CASE("Generate from string", "[from_str]") {
     SECTION("from specific string") {
         std::string src_str("6ba7b810-9dad-11d1-80b4-00c04fd430c8");
@@ -168,6 +242,8 @@ TEST_CASE("Generate from string", "[from_str]") {
     }
 }
 
+#if !UUIDXX_NO_EXCEPTIONS
+
 TEST_CASE("Invalid uuid string", "[from_str]") {
     SECTION("incorrect length with 1 digit missing in the last field") {
         std::string src_str("6ba7b810-9dad-11d1-80b4-00c04fd430c");
@@ -190,6 +266,8 @@ TEST_CASE("Invalid uuid string", "[from_str]") {
     }
 }
 
+#endif
+
 TEST_CASE("Generate from data bytes", "[from_data_bytes]") {
     SECTION("cutomized data byes") {
         constexpr auto uuid = make_from(data_bytes{0x6ba7b810, 0x9dad, 0x11d1, 0x80, 0xb4, 0x00,
@@ -0,0 +1,94 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuid_text_view.h"
+#include "uuidxx/uuidxx.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <unordered_set>
+
+namespace uuidxx {
+namespace {
+
+std::string to_upper(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::toupper(ch)); });
+    return str;
+}
+
+} // namespace
+
+TEST_CASE("Make text views", "[text_view]") {
+    CHECK(uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181c0").has_value());
+    CHECK(uuid_text_view::make("{2489E9AD-2EE2-8E00-8EC9-32D5F69181C0}").has_value());
+    CHECK(uuid_text_view::make("{2489E9AD-2EE2-8E00-8EC9-32D5F69181C0}")->text() ==
+          "2489E9AD-2EE2-8E00-8EC9-32D5F69181C0");
+
+    CHECK_FALSE(uuid_text_view::make("").has_value());
+    CHECK_FALSE(uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181c").has_value());
+    CHECK_FALSE(uuid_text_view::make("[2489e9ad-2ee2-8e00-8ec9-32d5f69181c0]").has_value());
+    CHECK_FALSE(uuid_text_view::make("2489e9ad+2ee2-8e00-8ec9-32d5f69181c0").has_value());
+    CHECK_FALSE(uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181cg").has_value());
+    CHECK_FALSE(uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181c0-").has_value());
+    CHECK_FALSE(uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f6918-c0").has_value());
+
+    // Every single invalid character is caught, in the SIMD part or the tail.
+    std::string base = "2489e9ad-2ee2-8e00-8ec9-32d5f69181c0";
+    for (std::size_t i = 0; i < base.size(); ++i) {
+        for (char ch : {'g', 'G', '/', ':', '@', '`', '-', '\x80', '\0'}) {
+            auto str = base;
+            if (str[i] == ch) {
+                continue;
+            }
+            str[i] = ch;
+            REQUIRE_FALSE(uuid_text_view::make(str).has_value());
+        }
+    }
+}
+
+TEST_CASE("Text views decode and hash like uuids", "[text_view]") {
+    for (int i = 0; i < 1000; ++i) {
+        auto id = i % 2 == 0 ? make_v4() : make_v1();
+        auto str = id.to_string();
+        auto upper = to_upper(str);
+
+        auto lower_view = *uuid_text_view::make(str);
+        auto upper_view = *uuid_text_view::make(upper);
+
+        REQUIRE(lower_view.to_uuid() == id);
+        REQUIRE(upper_view.to_uuid() == id);
+        REQUIRE(lower_view == upper_view);
+        REQUIRE(lower_view == id);
+        REQUIRE(std::hash<uuid_text_view>{}(lower_view) == std::hash<uuid>{}(id));
+        REQUIRE(std::hash<uuid_text_view>{}(upper_view) == std::hash<uuid>{}(id));
+    }
+
+    auto a = *uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181c0");
+    auto b = *uuid_text_view::make("2489e9ad-2ee2-8e00-8ec9-32d5f69181c1");
+    auto c = *uuid_text_view::make("3489e9ad-2ee2-8e00-8ec9-32d5f69181c0");
+    CHECK(a != b);
+    CHECK(a != c);
+    CHECK(a != make_v4());
+}
+
+TEST_CASE("Deduplicate text views", "[text_view]") {
+    std::vector<std::string> texts;
+    for (int i = 0; i < 100; ++i) {
+        auto str = make_v4().to_string();
+        texts.push_back(str);
+        texts.push_back(to_upper(str));
+    }
+
+    std::unordered_set<uuid_text_view> views;
+    for (const auto& text : texts) {
+        views.insert(*uuid_text_view::make(text));
+    }
+    CHECK(views.size() == 100);
+}
+
+} // namespace uuidxx
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "catch2/catch.hpp"
+
+#include "uuidxx/uuidxx.h"
+#include "uuidxx/v8_layout.h"
+
+namespace uuidxx {
+namespace {
+
+// Layout of the example in RFC 9562 B.1.
+struct custom_a : v8_field<0, 48> {};
+struct custom_b : v8_field<48, 12> {};
+struct custom_c_hi : v8_field<60, 62 - 32> {};
+struct custom_c_lo : v8_field<90, 32> {};
+
+using rfc_layout = v8_layout<custom_a, custom_b, custom_c_hi, custom_c_lo>;
+
+// Fields crossing the version and the variant.
+struct region : v8_field<0, 10> {};
+struct coarse_ts : v8_field<10, 44> {};
+struct shard : v8_field<54, 20> {};
+struct tail : v8_field<74, 48> {};
+
+using routing_layout = v8_layout<region, coarse_ts, shard, tail>;
+
+static_assert(is_valid_v8_layout<v8_field<0, 64>, v8_field<64, 58>>);
+static_assert(!is_valid_v8_layout<v8_field<0, 65>>);
+static_assert(!is_valid_v8_layout<v8_field<0, 0>>);
+static_assert(!is_valid_v8_layout<v8_field<100, 23>>);
+static_assert(!is_valid_v8_layout<v8_field<0, 48>, v8_field<40, 8>>);
+static_assert(!is_valid_v8_layout<>);
+
+// Fully evaluable at compile time.
+constexpr auto k_encoded = routing_layout::encode({1, 2, 3, 4});
+static_assert(routing_layout::get<shard>(k_encoded) == 3);
+static_assert(routing_layout::matches(k_encoded));
+
+} // namespace
+
+TEST_CASE("v8 example of RFC 9562", "[v8]") {
+    auto id = rfc_layout::encode({0x2489E9AD2EE2, 0xE00, 0x0EC932D5, 0xF69181C0});
+    CHECK(id.to_string() == "2489e9ad-2ee2-8e00-8ec9-32d5f69181c0");
+    CHECK(id.version() == version::v8);
+    CHECK(id.variant() == uuid_variant::rfc4122);
+    CHECK(id.is_valid_rfc());
+
+    auto parsed = make_from("2489E9AD-2EE2-8E00-8EC9-32D5F69181C0");
+    CHECK(rfc_layout::matches(parsed));
+    CHECK(rfc_layout::decode(parsed) ==
+          rfc_layout::values{0x2489E9AD2EE2, 0xE00, 0x0EC932D5, 0xF69181C0});
+}
+
+TEST_CASE("v8 fields round trip", "[v8]") {
+    uint64_t x = 0x9e3779b97f4a7c15;
+    for (int i = 0; i < 1000; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        routing_layout::values vals{x >> 54, x & ((UINT64_C(1) << 44) - 1), (x >> 20) & 0xfffff,
+                                    x >> 16};
+        auto id = routing_layout::encode(vals);
+        REQUIRE(id.version() == version::v8);
+        REQUIRE(id.variant() == uuid_variant::rfc4122);
+        REQUIRE(routing_layout::decode(id) == vals);
+    }
+}
+
+TEST_CASE("v8 values are truncated to widths", "[v8]") {
+    auto id = routing_layout::encode({~UINT64_C(0), 0, ~UINT64_C(0), 0});
+    CHECK(routing_layout::get<region>(id) == 0x3ff);
+    CHECK(routing_layout::get<coarse_ts>(id) == 0);
+    CHECK(routing_layout::get<shard>(id) == 0xfffff);
+    CHECK(routing_layout::get<tail>(id) == 0);
+    CHECK(id.version() == version::v8);
+    CHECK(id.variant() == uuid_variant::rfc4122);
+}
+
+TEST_CASE("v8 set replaces one field", "[v8]") {
+    auto id = routing_layout::encode({1, 2, 3, 4});
+    auto moved = routing_layout::set<shard>(id, 0xabcde);
+    CHECK(routing_layout::decode(moved) == routing_layout::values{1, 2, 0xabcde, 4});
+    CHECK(routing_layout::matches(moved));
+    CHECK_FALSE(routing_layout::matches(make_v4()));
+}
+
+} // namespace uuidxx
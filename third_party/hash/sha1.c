@@ -150,9 +150,11 @@ void SHA1_Transform(uint32_t state[5], const uint8_t buffer[64])
         uint8_t c[64];
         uint32_t l[16];
     } CHAR64LONG16;
-    CHAR64LONG16* block;
+    CHAR64LONG16 workspace;
+    CHAR64LONG16* block = &workspace;
 
-    block = (CHAR64LONG16*)buffer;
+    /* The expansion works in place; copy so that the caller's data stays intact. */
+    memcpy(block, buffer, 64);
 
     /* Copy context->state[] to working vars */
     a = state[0];
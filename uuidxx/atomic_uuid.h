@@ -0,0 +1,318 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_ATOMIC_UUID_H_
+#define UUIDXX_ATOMIC_UUID_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "uuidxx/uuid.h"
+
+// Native 16-byte compare-and-swap; which of them is usable is decided at runtime.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#define UUIDXX_CAS16_MSVC 1
+#include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define UUIDXX_CAS16_X86 1
+#include <cpuid.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define UUIDXX_CAS16_ARM 1
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace uuidxx {
+namespace details {
+
+struct use_seqlock_t {
+    explicit use_seqlock_t() = default;
+};
+
+inline constexpr use_seqlock_t use_seqlock{};
+
+struct cas16_support {
+    // cmpxchg16b on x86-64, casp of LSE on ARMv8.1, or the MSVC intrinsic.
+    bool cas;
+    // Aligned 16-byte vector loads are atomic on Intel and AMD processors with AVX, which
+    // spares readers the locked write of cmpxchg16b.
+    bool vector_load;
+};
+
+#if defined(UUIDXX_CAS16_X86)
+
+// Requires CPUID.1:ECX.OSXSAVE, or it faults.
+inline uint64_t read_xcr0() noexcept {
+    uint32_t lo;  // NOLINT(cppcoreguidelines-init-variables)
+    uint32_t hi;  // NOLINT(cppcoreguidelines-init-variables)
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+
+#endif
+
+inline cas16_support detect_cas16() noexcept {
+    cas16_support support{false, false};
+#if defined(UUIDXX_CAS16_MSVC)
+    // Required by 64-bit Windows 8.1 and later.
+    support.cas = true;
+#elif defined(UUIDXX_CAS16_X86)
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        support.cas = (ecx & bit_CMPXCHG16B) != 0;
+        // AVX instructions fault unless the OS saves YMM state, i.e. sets XCR0 bits 1-2.
+        const bool avx = (ecx & bit_AVX) != 0 && (ecx & bit_OSXSAVE) != 0 &&
+                         (read_xcr0() & 0x6) == 0x6;
+
+        char vendor[12];
+        __get_cpuid(0, &eax, &ebx, &ecx, &edx);
+        std::memcpy(vendor, &ebx, 4);
+        std::memcpy(vendor + 4, &edx, 4);
+        std::memcpy(vendor + 8, &ecx, 4);
+        support.vector_load = support.cas && avx &&
+                              (std::memcmp(vendor, "GenuineIntel", 12) == 0 ||
+                               std::memcmp(vendor, "AuthenticAMD", 12) == 0);
+    }
+#elif defined(UUIDXX_CAS16_ARM)
+#if defined(__ARM_FEATURE_ATOMICS)
+    support.cas = true;
+#elif defined(__linux__)
+    // HWCAP_ATOMICS.
+    support.cas = (getauxval(AT_HWCAP) & (1UL << 8)) != 0;
+#endif
+#endif
+    return support;
+}
+
+inline const cas16_support& cas16() noexcept {
+    static const cas16_support support = detect_cas16();
+    return support;
+}
+
+// Replaces `dst` with `desired` if it equals `expected`, otherwise loads it into `expected`;
+// a full barrier either way.
+// Requires `cas16().cas`.
+inline bool cas16(uint64_t* dst, uint64_t* expected, const uint64_t* desired) noexcept {
+#if defined(UUIDXX_CAS16_MSVC)
+    return _InterlockedCompareExchange128(reinterpret_cast<volatile __int64*>(dst),
+                                          static_cast<__int64>(desired[1]),
+                                          static_cast<__int64>(desired[0]),
+                                          reinterpret_cast<__int64*>(expected)) != 0;
+#elif defined(UUIDXX_CAS16_X86)
+    // rax and rdx hold the word at the lower and the higher address.
+    bool ok;  // NOLINT(cppcoreguidelines-init-variables)
+    __asm__ __volatile__("lock cmpxchg16b %1"
+                         : "=@ccz"(ok), "+m"(*reinterpret_cast<unsigned __int128*>(dst)),
+                           "+a"(expected[0]), "+d"(expected[1])
+                         : "b"(desired[0]), "c"(desired[1])
+                         : "memory");
+    return ok;
+#elif defined(UUIDXX_CAS16_ARM)
+    // casp needs pairs of consecutive registers, starting at even ones.
+    register uint64_t x0 __asm__("x0") = expected[0];
+    register uint64_t x1 __asm__("x1") = expected[1];
+    register uint64_t x2 __asm__("x2") = desired[0];
+    register uint64_t x3 __asm__("x3") = desired[1];
+    const uint64_t e0 = x0;
+    const uint64_t e1 = x1;
+    __asm__ __volatile__(".arch_extension lse\n"
+                         "caspal x0, x1, x2, x3, [%[dst]]"
+                         : "+r"(x0), "+r"(x1)
+                         : "r"(x2), "r"(x3), [dst] "r"(dst)
+                         : "memory");
+    expected[0] = x0;
+    expected[1] = x1;
+    return x0 == e0 && x1 == e1;
+#else
+    (void)dst;
+    (void)expected;
+    (void)desired;
+    return false;
+#endif
+}
+
+// Requires `cas16().vector_load`.
+inline void vector_load16(const uint64_t* src, uint64_t* out) noexcept {
+#if defined(UUIDXX_CAS16_X86)
+    // Not an intrinsic, which the compiler might merge with other loads or hoist out of
+    // loops.
+    using vec = long long __attribute__((vector_size(16)));
+    vec v;
+    __asm__ __volatile__("vmovdqa %1, %0" : "=x"(v) : "m"(*reinterpret_cast<const vec*>(src))
+                         : "memory");
+    std::memcpy(out, &v, sizeof(v));
+#else
+    (void)src;
+    (void)out;
+#endif
+}
+
+// Words under a seqlock are still accessed atomically, as readers race with the writer by
+// design.
+
+inline uint64_t load_word_relaxed(const uint64_t* src) noexcept {
+#if defined(_MSC_VER)
+    return static_cast<uint64_t>(
+            __iso_volatile_load64(reinterpret_cast<const volatile __int64*>(src)));
+#else
+    return __atomic_load_n(src, __ATOMIC_RELAXED);
+#endif
+}
+
+inline void store_word_relaxed(uint64_t* dst, uint64_t value) noexcept {
+#if defined(_MSC_VER)
+    __iso_volatile_store64(reinterpret_cast<volatile __int64*>(dst),
+                           static_cast<__int64>(value));
+#else
+    __atomic_store_n(dst, value, __ATOMIC_RELAXED);
+#endif
+}
+
+} // namespace details
+
+// A uuid that is loaded and modified atomically; loads acquire, and modifications are full
+// barriers.
+// It is lock-free if the processor has 16-byte compare-and-swap, see above; otherwise it
+// falls back to a seqlock, on which readers never write shared memory, but retry while a
+// writer is in progress, and writers spin on each other.
+class alignas(16) atomic_uuid {
+public:
+    explicit atomic_uuid(const uuid& id) noexcept
+        : lock_free_(details::cas16().cas) {
+        set_words(id);
+    }
+
+    // Always uses the seqlock, e.g. to compare with.
+    atomic_uuid(const uuid& id, details::use_seqlock_t) noexcept
+        : lock_free_(false) {
+        set_words(id);
+    }
+
+    atomic_uuid(const atomic_uuid&) = delete;
+
+    atomic_uuid(atomic_uuid&&) = delete;
+
+    atomic_uuid& operator=(const atomic_uuid&) = delete;
+
+    atomic_uuid& operator=(atomic_uuid&&) = delete;
+
+    [[nodiscard]] bool is_lock_free() const noexcept {
+        return lock_free_;
+    }
+
+    [[nodiscard]] uuid load() const noexcept {
+        uuid::data raw{0, 0};
+        if (!lock_free_) {
+            seqlock_read(raw);
+        } else if (details::cas16().vector_load) {
+            details::vector_load16(words_, raw.data());
+        } else {
+            // Stores back the same value if it happens to be zeros.
+            details::cas16(words_, raw.data(), raw.data());
+        }
+        return uuid(raw, details::gen_from_raw_data);
+    }
+
+    void store(const uuid& id) noexcept {
+        (void)exchange(id);
+    }
+
+    uuid exchange(const uuid& id) noexcept {
+        const auto& desired = id.raw_data();
+        uuid::data prev{0, 0};
+        if (lock_free_) {
+            while (!details::cas16(words_, prev.data(), desired.data())) {
+            }
+        } else {
+            const auto seq = seqlock_lock();
+            prev[0] = details::load_word_relaxed(&words_[0]);
+            prev[1] = details::load_word_relaxed(&words_[1]);
+            seqlock_write(desired);
+            seqlock_unlock(seq);
+        }
+        return uuid(prev, details::gen_from_raw_data);
+    }
+
+    // Replaces the value with `desired` if it equals `expected`, otherwise loads it into
+    // `expected`; never fails spuriously.
+    bool compare_exchange(uuid& expected, const uuid& desired) noexcept {
+        auto raw = expected.raw_data();
+        bool ok = false;
+        if (lock_free_) {
+            ok = details::cas16(words_, raw.data(), desired.raw_data().data());
+        } else {
+            const auto seq = seqlock_lock();
+            const uuid::data current{details::load_word_relaxed(&words_[0]),
+                                     details::load_word_relaxed(&words_[1])};
+            ok = current == raw;
+            if (ok) {
+                seqlock_write(desired.raw_data());
+            } else {
+                raw = current;
+            }
+            seqlock_unlock(seq);
+        }
+
+        if (!ok) {
+            expected = uuid(raw, details::gen_from_raw_data);
+        }
+        return ok;
+    }
+
+private:
+    void set_words(const uuid& id) noexcept {
+        words_[0] = id.raw_data()[0];
+        words_[1] = id.raw_data()[1];
+    }
+
+    void seqlock_read(uuid::data& raw) const noexcept {
+        for (;;) {
+            const auto seq = seq_.load(std::memory_order_acquire);
+            if ((seq & 1) == 0) {
+                raw[0] = details::load_word_relaxed(&words_[0]);
+                raw[1] = details::load_word_relaxed(&words_[1]);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (seq_.load(std::memory_order_relaxed) == seq) {
+                    return;
+                }
+            }
+        }
+    }
+
+    // Returns the sequence before locking, which is even.
+    uint32_t seqlock_lock() noexcept {
+        for (;;) {
+            auto seq = seq_.load(std::memory_order_relaxed);
+            if ((seq & 1) == 0 &&
+                seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire)) {
+                std::atomic_thread_fence(std::memory_order_release);
+                return seq;
+            }
+        }
+    }
+
+    void seqlock_write(const uuid::data& raw) noexcept {
+        details::store_word_relaxed(&words_[0], raw[0]);
+        details::store_word_relaxed(&words_[1], raw[1]);
+    }
+
+    void seqlock_unlock(uint32_t seq) noexcept {
+        seq_.store(seq + 2, std::memory_order_seq_cst);
+    }
+
+private:
+    // Same layout as `uuid::data`; mutable, as loading by compare-and-swap writes it.
+    mutable uint64_t words_[2];
+    std::atomic<uint32_t> seq_{0};
+    const bool lock_free_;
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_ATOMIC_UUID_H_
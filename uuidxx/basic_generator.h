@@ -0,0 +1,224 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_BASIC_GENERATOR_H_
+#define UUIDXX_BASIC_GENERATOR_H_
+
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include "uuidxx/clock_sequence.h"
+#include "uuidxx/config.h"
+#include "uuidxx/node_fetcher.h"
+#include "uuidxx/rand_generator.h"
+#include "uuidxx/stats.h"
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+//
+// Clock policies, which provide `std::tuple<uint64_t, uint16_t> read()`, returning the
+// timestamp in 100ns intervals since UUID epoch and the clock sequence.
+//
+
+// Shares the process-wide `clock_sequence`; this is what `make_v1()` uses.
+struct shared_clock {
+    std::tuple<uint64_t, uint16_t> read() {
+        return clock_sequence::instance().read();
+    }
+};
+
+// Keeps its own clock sequence without any locking, thus it is not thread-safe.
+// Ids are unique only if no other generator shares the node id, e.g. one generator per
+// thread, each with a distinct `fixed_node`.
+class local_clock {
+public:
+    constexpr local_clock() noexcept = default;
+
+    constexpr explicit local_clock(uint16_t seq) noexcept
+        : seq_(seq),
+          seeded_(true) {}
+
+    std::tuple<uint64_t, uint16_t> read() {
+        if (!seeded_) {
+            seq_ = static_cast<uint16_t>(std::random_device{}());
+            seeded_ = true;
+        }
+
+        const uint64_t now = clock_sequence::get_timestamp_since_epoch();
+        if (now <= last_time_) {
+            ++seq_;
+        }
+
+        last_time_ = now;
+        return std::make_tuple(now, seq_);
+    }
+
+private:
+    uint64_t last_time_{0};
+    uint16_t seq_{0};
+    bool seeded_{false};
+};
+
+//
+// Rand policies, which provide `uint64_t operator()()`.
+//
+
+// Shares the process-wide engine, which takes a lock on each call; this is what
+// `make_v4()` uses.
+struct global_rand {
+    uint64_t operator()() {
+        return default_rand_gen();
+    }
+};
+
+// xoshiro256** owned by the generator; not thread-safe.
+// A default constructed one is seeded from `std::random_device` on first use.
+class local_rand {
+public:
+    constexpr local_rand() noexcept = default;
+
+    constexpr explicit local_rand(uint64_t seed) noexcept {
+        reseed(seed);
+    }
+
+    uint64_t operator()() {
+        if (!seeded_) {
+            std::random_device rd;
+            reseed((static_cast<uint64_t>(rd()) << 32) | rd());
+        }
+
+        const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+
+        return result;
+    }
+
+private:
+    static constexpr uint64_t rotl(uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    // Expands the seed by splitmix64, which never yields an all-zero state.
+    constexpr void reseed(uint64_t seed) noexcept {
+        for (auto& s : state_) {
+            seed += UINT64_C(0x9e37'79b9'7f4a'7c15);
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * UINT64_C(0xbf58'476d'1ce4'e5b9);
+            z = (z ^ (z >> 27)) * UINT64_C(0x94d0'49bb'1331'11eb);
+            s = z ^ (z >> 31);
+        }
+        seeded_ = true;
+    }
+
+private:
+    uint64_t state_[4]{};
+    bool seeded_{false};
+};
+
+//
+// Node policies, which provide `void operator()(node_id&)`.
+//
+
+// Reads the node id resolved by `read_mac_addr_as_node_id()` and caches it, as the node
+// id never changes once resolved.
+class mac_node {
+public:
+    constexpr mac_node() noexcept = default;
+
+    void operator()(node_id& id) {
+        if (!resolved_) {
+            read_mac_addr_as_node_id(id_);
+            resolved_ = true;
+        }
+
+        id = id_;
+    }
+
+private:
+    node_id id_{};
+    bool resolved_{false};
+};
+
+class fixed_node {
+public:
+    constexpr explicit fixed_node(const node_id& id) noexcept
+        : id_(id) {}
+
+    void operator()(node_id& id) const noexcept {
+        id = id_;
+    }
+
+private:
+    node_id id_;
+};
+
+// Composes policies at compile time, so that calls into them can be inlined, and
+// stateless policies take no space.
+// Thread-safety follows the policies; with the defaults, it is equivalent to `make_v1()`
+// and `make_v4()`.
+// All policies shipped are constant-initializable, thus a generator can be defined at
+// namespace scope, or as `thread_local`, with `UUIDXX_CONSTINIT` and no guard on access.
+template<typename ClockPolicy = shared_clock,
+         typename RandPolicy = global_rand,
+         typename NodePolicy = mac_node>
+class basic_generator : private ClockPolicy, private RandPolicy, private NodePolicy {
+public:
+    using clock_policy = ClockPolicy;
+    using rand_policy = RandPolicy;
+    using node_policy = NodePolicy;
+
+    constexpr basic_generator() = default;
+
+    constexpr basic_generator(ClockPolicy clock, RandPolicy rand, NodePolicy node)
+        : ClockPolicy(std::move(clock)),
+          RandPolicy(std::move(rand)),
+          NodePolicy(std::move(node)) {}
+
+    uuid make_v1() {
+        const details::scoped_generation_stat stat(stat_counter::generated_v1);
+        auto [ts, seq] = static_cast<ClockPolicy&>(*this).read();
+
+        node_id id;
+        static_cast<NodePolicy&>(*this)(id);
+
+        return uuid(ts, seq, id, details::gen_v1);
+    }
+
+    uuid make_v4() {
+        const details::scoped_generation_stat stat(stat_counter::generated_v4);
+        return uuid(static_cast<RandPolicy&>(*this), details::gen_v4);
+    }
+
+    ClockPolicy& clock() noexcept {
+        return *this;
+    }
+
+    RandPolicy& rand() noexcept {
+        return *this;
+    }
+
+    NodePolicy& node() noexcept {
+        return *this;
+    }
+};
+
+using default_generator = basic_generator<>;
+
+// Generator for exclusive use of one thread, which takes no lock at all.
+// The node id must not be used by any other generator, see `local_clock`.
+using local_generator = basic_generator<local_clock, local_rand, fixed_node>;
+
+} // namespace uuidxx
+
+#endif // UUIDXX_BASIC_GENERATOR_H_
@@ -0,0 +1,59 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_BIT_UTILS_H_
+#define UUIDXX_BIT_UTILS_H_
+
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace uuidxx {
+namespace details {
+
+// `n` must not be 0.
+inline int count_leading_zeros(uint64_t n) noexcept {
+#if defined(_MSC_VER)
+    unsigned long idx;   // NOLINT(google-runtime-int)
+    _BitScanReverse64(&idx, n);
+    return 63 - static_cast<int>(idx);
+#else
+    return __builtin_clzll(n);
+#endif
+}
+
+// `n` must not be 0.
+inline int floor_log2(uint64_t n) noexcept {
+    return 63 - count_leading_zeros(n);
+}
+
+constexpr std::array<int8_t, 256> make_hex_table() {
+    std::array<int8_t, 256> table{};
+    for (auto& v : table) {
+        v = -1;
+    }
+    for (int i = 0; i < 10; ++i) {
+        table['0' + i] = static_cast<int8_t>(i);
+    }
+    for (int i = 0; i < 6; ++i) {
+        table['a' + i] = static_cast<int8_t>(10 + i);
+        table['A' + i] = static_cast<int8_t>(10 + i);
+    }
+    return table;
+}
+
+// Values of hexadecimal digits in either case, and -1 for other characters.
+inline constexpr auto k_hex_table = make_hex_table();
+
+inline int hex_value(char ch) noexcept {
+    return k_hex_table[static_cast<unsigned char>(ch)];
+}
+
+} // namespace details
+} // namespace uuidxx
+
+#endif // UUIDXX_BIT_UTILS_H_
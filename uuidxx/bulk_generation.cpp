@@ -0,0 +1,86 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/bulk_generation.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "uuidxx/basic_generator.h"
+#include "uuidxx/cache_line.h"
+#include "uuidxx/parallel_for.h"
+#include "uuidxx/stats.h"
+
+namespace uuidxx {
+namespace {
+
+constexpr std::size_t k_ids_per_line = details::k_cache_line_size / sizeof(uuid);
+
+// Calls `fn(first, last)` over partitions of [0, count), one partition per thread.
+template<typename Fn>
+void run_partitioned(uuid* out, std::size_t count, const bulk_options& opts, Fn fn) {
+    const auto workers = details::worker_count(count, opts.threads, opts.min_ids_per_thread);
+    if (workers == 1) {
+        fn(std::size_t{0}, count);
+        return;
+    }
+
+    // Index of the first id starting a cache line; it is inexact if `out` is not aligned
+    // to `sizeof(uuid)`, and then neighbors share at most one line.
+    const auto addr = reinterpret_cast<std::uintptr_t>(out);
+    const std::size_t skew =
+            ((details::k_cache_line_size - addr % details::k_cache_line_size) %
+             details::k_cache_line_size) /
+            sizeof(uuid);
+
+    std::vector<std::size_t> bounds(workers + 1, count);
+    bounds[0] = 0;
+    for (std::size_t i = 1; i < workers; ++i) {
+        auto pos = count / workers * i;
+        pos = pos < skew ? skew : skew + (pos - skew) / k_ids_per_line * k_ids_per_line;
+        bounds[i] = std::clamp(pos, bounds[i - 1], count);
+    }
+
+    details::parallel_for(workers,
+                          [&fn, &bounds](std::size_t w) { fn(bounds[w], bounds[w + 1]); });
+}
+
+template<typename Tag>
+void make_named_bulk(const uuid& ns, const std::string_view* names, std::size_t count,
+                     uuid* out, const bulk_options& opts, stat_counter counter) {
+    run_partitioned(out, count, opts, [&ns, names, out, counter](std::size_t first,
+                                                                  std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            out[i] = uuid(ns, names[i], Tag{});
+        }
+        details::record_stat(counter, last - first);
+    });
+}
+
+} // namespace
+
+void make_v3_bulk(const uuid& ns, const std::string_view* names, std::size_t count, uuid* out,
+                  const bulk_options& opts) {
+    make_named_bulk<details::gen_v3_t>(ns, names, count, out, opts,
+                                       stat_counter::generated_v3);
+}
+
+void make_v5_bulk(const uuid& ns, const std::string_view* names, std::size_t count, uuid* out,
+                  const bulk_options& opts) {
+    make_named_bulk<details::gen_v5_t>(ns, names, count, out, opts,
+                                       stat_counter::generated_v5);
+}
+
+void make_v4_bulk(uuid* out, std::size_t count, const bulk_options& opts) {
+    run_partitioned(out, count, opts, [out](std::size_t first, std::size_t last) {
+        local_rand rand;
+        for (auto i = first; i < last; ++i) {
+            out[i] = uuid(rand, details::gen_v4);
+        }
+        details::record_stat(stat_counter::generated_v4, last - first);
+    });
+}
+
+} // namespace uuidxx
@@ -0,0 +1,41 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_BULK_GENERATION_H_
+#define UUIDXX_BULK_GENERATION_H_
+
+#include <cstddef>
+#include <string_view>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+struct bulk_options {
+    // Number of threads, including the calling one; 0 means number of cores.
+    std::size_t threads{0};
+
+    // Fewer threads are used if each would get fewer ids than this, as starting a thread
+    // costs about as much as hashing a few thousand names.
+    std::size_t min_ids_per_thread{4096};
+};
+
+// Bulk versions of `make_v3()`, `make_v4()` and `make_v5()`, which partition the work
+// over threads and return once all is done.
+// `out` must have room for `count` uuids, e.g. a vector filled with `k_nil`. Partitions
+// are split at cache line boundaries of `out`, thus threads don't write the same lines.
+
+void make_v3_bulk(const uuid& ns, const std::string_view* names, std::size_t count, uuid* out,
+                  const bulk_options& opts = {});
+
+void make_v5_bulk(const uuid& ns, const std::string_view* names, std::size_t count, uuid* out,
+                  const bulk_options& opts = {});
+
+// Each thread uses its own engine seeded by `std::random_device`, instead of the shared
+// one behind `make_v4()`.
+void make_v4_bulk(uuid* out, std::size_t count, const bulk_options& opts = {});
+
+} // namespace uuidxx
+
+#endif // UUIDXX_BULK_GENERATION_H_
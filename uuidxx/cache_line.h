@@ -0,0 +1,20 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CACHE_LINE_H_
+#define UUIDXX_CACHE_LINE_H_
+
+#include <cstddef>
+
+namespace uuidxx {
+namespace details {
+
+// `std::hardware_destructive_interference_size` is not reliably available and GCC warns
+// on its use, and all platforms we care about have 64-byte cache lines.
+inline constexpr std::size_t k_cache_line_size = 64;
+
+} // namespace details
+} // namespace uuidxx
+
+#endif // UUIDXX_CACHE_LINE_H_
@@ -0,0 +1,68 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/clock_segment.h"
+
+#include "uuidxx/stats.h"
+
+namespace uuidxx {
+namespace details {
+
+UUIDXX_INLINE bool clock_segment::open_named(const std::string& name, uint16_t seq) {
+    if (!file_.open_shared(name, sizeof(state))) {
+        return false;
+    }
+
+    init(seq);
+    return true;
+}
+
+UUIDXX_INLINE bool clock_segment::open_anonymous(uint16_t seq) {
+    if (!file_.open_anonymous(sizeof(state))) {
+        return false;
+    }
+
+    init(seq);
+    return true;
+}
+
+UUIDXX_INLINE void clock_segment::init(uint16_t seq) noexcept {
+    // Shared memory is filled with zeros on creation, which is a valid representation of
+    // lock-free atomics.
+    state_ = static_cast<state*>(file_.data());
+
+    // The first one wins if processes race to create the segment.
+    uint64_t word = 0;
+    const uint64_t desired = (UINT64_C(1) << 16) | seq;
+    if (state_->seq_word.compare_exchange_strong(word, desired, std::memory_order_acq_rel)) {
+        word = desired;
+    }
+
+    seq_ = static_cast<uint16_t>(word);
+}
+
+UUIDXX_INLINE std::tuple<uint64_t, uint16_t> clock_segment::read(uint64_t now) noexcept {
+    auto last = state_->last_time.load(std::memory_order_relaxed);
+    uint64_t next;  // NOLINT(cppcoreguidelines-init-variables)
+    do {
+        next = now > last ? now : last + 1;
+    } while (!state_->last_time.compare_exchange_weak(last, next, std::memory_order_relaxed));
+
+    // `last_time` runs ahead of the clock when ids are drawn within one tick, so regressions
+    // are told by the latest clock reading instead.
+    auto latest = state_->last_clock.load(std::memory_order_relaxed);
+    while (now > latest &&
+           !state_->last_clock.compare_exchange_weak(latest, now, std::memory_order_relaxed)) {
+    }
+
+    if (next != now) {
+        record_stat(now < latest ? stat_counter::clock_regression
+                                 : stat_counter::clock_collision);
+    }
+
+    return std::make_tuple(next, seq_);
+}
+
+} // namespace details
+} // namespace uuidxx
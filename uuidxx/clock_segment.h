@@ -0,0 +1,81 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CLOCK_SEGMENT_H_
+#define UUIDXX_CLOCK_SEGMENT_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "uuidxx/cache_line.h"
+#include "uuidxx/config.h"
+#include "uuidxx/mapped_file.h"
+
+namespace uuidxx {
+namespace details {
+
+// Clock state shared by processes on a host through shared memory.
+// Rather than bumping the clock sequence, which takes a lock to update along with the
+// timestamp, the last timestamp is advanced by CAS to max(now, last + 1); thus, all
+// processes draw from one stream of distinct timestamps, and the sequence never changes.
+// Timestamps may run ahead of the clock briefly if ids are generated faster than one per
+// 100ns, or the clock is set backward.
+// This class is thread-safe, except for `open_*()`.
+class clock_segment {
+public:
+    struct state {
+        // (1 << 16) | seq once initialized; 0 otherwise.
+        std::atomic<uint64_t> seq_word;
+        alignas(k_cache_line_size) std::atomic<uint64_t> last_time;
+        // The latest clock reading passed to `read()`.
+        std::atomic<uint64_t> last_clock;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "atomics in shared memory must be lock-free");
+
+    clock_segment() noexcept = default;
+
+    ~clock_segment() = default;
+
+    clock_segment(const clock_segment&) = delete;
+
+    clock_segment(clock_segment&&) = delete;
+
+    clock_segment& operator=(const clock_segment&) = delete;
+
+    clock_segment& operator=(clock_segment&&) = delete;
+
+    // Shares with processes that open the same name.
+    // `seq` is used only if the segment is created by this call.
+    bool open_named(const std::string& name, uint16_t seq);
+
+    // Shares with child processes forked afterwards.
+    bool open_anonymous(uint16_t seq);
+
+    [[nodiscard]] bool is_open() const noexcept {
+        return state_ != nullptr;
+    }
+
+    std::tuple<uint64_t, uint16_t> read(uint64_t now) noexcept;
+
+private:
+    void init(uint16_t seq) noexcept;
+
+private:
+    mapped_file file_;
+    state* state_{nullptr};
+    uint16_t seq_{0};
+};
+
+} // namespace details
+} // namespace uuidxx
+
+#if defined(UUIDXX_HEADER_ONLY)
+#include "uuidxx/clock_segment.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+
+#endif // UUIDXX_CLOCK_SEGMENT_H_
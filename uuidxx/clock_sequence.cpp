@@ -6,26 +6,32 @@
 
 #include <random>
 
+#include "uuidxx/stats.h"
+
 namespace uuidxx {
 
-clock_sequence::clock_sequence()
+UUIDXX_INLINE clock_sequence::clock_sequence()
     : seq_(static_cast<uint16_t>(std::random_device{}())) {}
 
 // static
-clock_sequence& clock_sequence::instance() {
+UUIDXX_INLINE clock_sequence& clock_sequence::instance() {
     static clock_sequence instance;
     return instance;
 }
 
 // static
-uint64_t clock_sequence::get_timestamp_since_epoch() {
+UUIDXX_INLINE uint64_t clock_sequence::get_timestamp_since_epoch() {
     auto ts = k_epoch_diff + std::chrono::duration_cast<clock_sequence::duration>(
                                      std::chrono::system_clock::now().time_since_epoch());
     return ts.count();
 }
 
-std::tuple<uint64_t, uint16_t> clock_sequence::read() {
+UUIDXX_INLINE std::tuple<uint64_t, uint16_t> clock_sequence::read() {
     const uint64_t now = get_timestamp_since_epoch();
+    if (shared_.load(std::memory_order_acquire)) {
+        return segment_.read(now);
+    }
+
     uint16_t seq;   // NOLINT(cppcoreguidelines-init-variables)
 
     {
@@ -34,13 +40,51 @@ std::tuple<uint64_t, uint16_t> clock_sequence::read() {
         // The clock is set backward or read too fast.
         if (now <= last_time_) {
             ++seq_;
+            details::record_stat(now < last_time_ ? stat_counter::clock_regression
+                                                  : stat_counter::clock_collision);
         }
 
         last_time_ = now;
         seq = seq_;
+
+        if (storage_.is_open()) {
+            storage_.update(now, seq);
+        }
     }
 
     return std::make_tuple(now, seq);
 }
 
+UUIDXX_INLINE bool clock_sequence::use_stable_storage(const std::string& path,
+                                                    std::chrono::milliseconds window) {
+    const std::lock_guard lock(mtx_);
+    if (storage_.is_open() || segment_.is_open() ||
+        !storage_.open(path, std::chrono::duration_cast<duration>(window).count())) {
+        return false;
+    }
+
+    storage_.restore(get_timestamp_since_epoch(), seq_);
+    return true;
+}
+
+UUIDXX_INLINE bool clock_sequence::use_shared_memory(const std::string& name) {
+    const std::lock_guard lock(mtx_);
+    if (storage_.is_open() || segment_.is_open() || !segment_.open_named(name, seq_)) {
+        return false;
+    }
+
+    shared_.store(true, std::memory_order_release);
+    return true;
+}
+
+UUIDXX_INLINE bool clock_sequence::use_shared_memory() {
+    const std::lock_guard lock(mtx_);
+    if (storage_.is_open() || segment_.is_open() || !segment_.open_anonymous(seq_)) {
+        return false;
+    }
+
+    shared_.store(true, std::memory_order_release);
+    return true;
+}
+
 } // namespace uuidxx
@@ -5,8 +5,16 @@
 #ifndef UUIDXX_CLOCK_SEQUENCE_H_
 #define UUIDXX_CLOCK_SEQUENCE_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <mutex>
+#include <string>
+#include <tuple>
+
+#include "uuidxx/clock_segment.h"
+#include "uuidxx/clock_storage.h"
+#include "uuidxx/config.h"
 
 namespace uuidxx {
 
@@ -16,6 +24,10 @@ private:
     using duration = std::chrono::duration<uint64_t, std::ratio<1, 10'000'000>>;
 
 public:
+    // Independent of `instance()`, which is what generation uses; ids from distinct clock
+    // sequences on one node may collide, so it is only meant for tests.
+    clock_sequence();
+
     ~clock_sequence() = default;
 
     clock_sequence(const clock_sequence&) = delete;
@@ -30,8 +42,28 @@ public:
 
     std::tuple<uint64_t, uint16_t> read();
 
-private:
-    clock_sequence();
+    // Keeps clock state in the file at `path` from now on, so that restarts and clocks
+    // set backward don't risk duplicates.
+    // Each time the clock passes the reserved window, timestamps up to `window` ahead are
+    // reserved, and only then the file is flushed.
+    // Returns false if the file cannot be used, or stable storage or shared memory is
+    // already in use.
+    // Call it on startup, before any generation.
+    bool use_stable_storage(const std::string& path,
+                            std::chrono::milliseconds window = std::chrono::seconds(1));
+
+    // Draws timestamps from clock state shared with other processes from now on, without
+    // any lock; so that processes on a host, which share the node id, never generate
+    // duplicates.
+    // The named one is shared with processes opening the same name; the anonymous one is
+    // shared with child processes forked afterwards, e.g. pre-fork workers, and is not
+    // supported on Windows.
+    // Returns false if the shared memory cannot be used, or stable storage or shared
+    // memory is already in use.
+    // Call it on startup, before any generation.
+    bool use_shared_memory(const std::string& name);
+
+    bool use_shared_memory();
 
     // Gets 100ns interval count since UUID epoch.
     static uint64_t get_timestamp_since_epoch();
@@ -40,6 +72,9 @@ private:
     std::mutex mtx_;
     uint64_t last_time_{0};
     uint16_t seq_;
+    details::clock_storage storage_;
+    details::clock_segment segment_;
+    std::atomic<bool> shared_{false};
 
     // Difference in 100ns intervals between UUID epoch (1582/10/15 00:00:00) and Unix
     // epoch (1970/01/01 00:00:00)
@@ -48,4 +83,8 @@ private:
 
 } // namespace uuidxx
 
+#if defined(UUIDXX_HEADER_ONLY)
+#include "uuidxx/clock_sequence.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+
 #endif // UUIDXX_CLOCK_SEQUENCE_H_
@@ -0,0 +1,64 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/clock_storage.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace uuidxx {
+namespace details {
+
+static_assert(std::is_trivially_copyable_v<clock_storage::state>);
+
+UUIDXX_INLINE bool clock_storage::open(const std::string& path, uint64_t window) {
+    if (!file_.open(path, sizeof(state))) {
+        return false;
+    }
+
+    // A new file is filled with zeros.
+    auto st = static_cast<state*>(file_.data());
+    if (st->magic != 0 && (st->magic != k_magic || st->version != k_version)) {
+        file_.close();
+        return false;
+    }
+
+    state_ = st;
+    window_ = window;
+    return true;
+}
+
+UUIDXX_INLINE void clock_storage::restore(uint64_t now, uint16_t& seq) {
+    if (state_->magic == k_magic) {
+        if (now > state_->reserved_until) {
+            seq = state_->seq;
+        } else if (((seq ^ state_->seq) & 0x3fff) == 0) {
+            // Only low 14 bits make it into uuids.
+            ++seq;
+        }
+    } else {
+        state_->version = k_version;
+        state_->magic = k_magic;
+    }
+
+    state_->seq = seq;
+    reserve(now);
+}
+
+UUIDXX_INLINE void clock_storage::update(uint64_t now, uint16_t seq) {
+    state_->seq = seq;
+    if (now > state_->reserved_until) {
+        reserve(now);
+    }
+}
+
+UUIDXX_INLINE void clock_storage::reserve(uint64_t now) {
+    state_->reserved_until = std::max(state_->reserved_until, now + window_);
+    // Only crashes of the system lose the reservation on failure, and there is nothing
+    // better to do than going on.
+    file_.flush();
+}
+
+} // namespace details
+} // namespace uuidxx
@@ -0,0 +1,89 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CLOCK_STORAGE_H_
+#define UUIDXX_CLOCK_STORAGE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "uuidxx/config.h"
+#include "uuidxx/mapped_file.h"
+
+namespace uuidxx {
+namespace details {
+
+// Stable storage of clock state, as recommended by RFC 4122 4.2.1.
+// Rather than the last timestamp, the end of a reservation window is stored: the owner
+// may generate timestamps up to it without touching the storage, and a new window is
+// reserved, and flushed, only when the clock passes the end.
+// The clock sequence is stored into the mapping on each change, which costs a plain
+// store and survives crashes of the process, but not of the system; thus it is trusted
+// only once its window has passed.
+// This class is not thread-safe.
+class clock_storage {
+public:
+    struct state {
+        uint32_t magic;
+        uint32_t version;
+        // In 100ns intervals since UUID epoch.
+        uint64_t reserved_until;
+        uint16_t seq;
+    };
+
+    static constexpr uint32_t k_magic = 0x53'43'58'55; // "UXCS"
+    static constexpr uint32_t k_version = 1;
+
+    clock_storage() noexcept = default;
+
+    ~clock_storage() = default;
+
+    clock_storage(const clock_storage&) = delete;
+
+    clock_storage(clock_storage&&) = delete;
+
+    clock_storage& operator=(const clock_storage&) = delete;
+
+    clock_storage& operator=(clock_storage&&) = delete;
+
+    // `window` is in 100ns intervals.
+    // Returns false if the file cannot be opened or mapped, or it is occupied by data of
+    // other kinds.
+    bool open(const std::string& path, uint64_t window);
+
+    [[nodiscard]] bool is_open() const noexcept {
+        return file_.is_open();
+    }
+
+    // Restores clock sequence from the stored state, given a random `seq`.
+    // If `now` falls into the last reservation window, timestamps might have been issued
+    // already, or the clock was set backward; and the stored sequence might have advanced
+    // further without being flushed. The stored one is then unknown, and `seq` is kept,
+    // as recommended by RFC 4122 4.2.1; bumped if it happens to equal the stored one.
+    // Leaves `seq` intact and starts a fresh state if nothing was stored.
+    void restore(uint64_t now, uint16_t& seq);
+
+    void update(uint64_t now, uint16_t seq);
+
+    [[nodiscard]] uint64_t reserved_until() const noexcept {
+        return state_->reserved_until;
+    }
+
+private:
+    void reserve(uint64_t now);
+
+private:
+    mapped_file file_;
+    state* state_{nullptr};
+    uint64_t window_{0};
+};
+
+} // namespace details
+} // namespace uuidxx
+
+#if defined(UUIDXX_HEADER_ONLY)
+#include "uuidxx/clock_storage.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+
+#endif // UUIDXX_CLOCK_STORAGE_H_
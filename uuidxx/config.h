@@ -0,0 +1,34 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CONFIG_H_
+#define UUIDXX_CONFIG_H_
+
+// With `UUIDXX_HEADER_ONLY`, the core generation path, i.e. uuid, clock sequence and
+// node id, is defined in headers, so that it can be inlined into callers.
+// Definitions in those source files are marked with `UUIDXX_INLINE` accordingly.
+#if defined(UUIDXX_HEADER_ONLY)
+#define UUIDXX_INLINE inline
+#else
+#define UUIDXX_INLINE
+#endif
+
+// Guarantees constant initialization where supported, i.e. since C++ 20.
+#if defined(__cpp_constinit)
+#define UUIDXX_CONSTINIT constinit
+#else
+#define UUIDXX_CONSTINIT
+#endif
+
+// With `UUIDXX_NO_EXCEPTIONS`, e.g. for `-fno-exceptions` builds, throwing APIs abort
+// instead; use the overloads taking `std::error_code` to handle failures.
+#if !defined(UUIDXX_NO_EXCEPTIONS)
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#define UUIDXX_NO_EXCEPTIONS 0
+#else
+#define UUIDXX_NO_EXCEPTIONS 1
+#endif
+#endif
+
+#endif // UUIDXX_CONFIG_H_
@@ -0,0 +1,54 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_CPU_FEATURES_H_
+#define UUIDXX_CPU_FEATURES_H_
+
+// SIMD kernels are compiled with per-function target attributes and selected at runtime,
+// thus no special compiler flags are required for the whole build.
+// On other compilers or architectures, only scalar versions are available.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UUIDXX_HAS_X86_SIMD 1
+#define UUIDXX_TARGET_AVX2 __attribute__((target("avx2")))
+#define UUIDXX_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl")))
+#include <immintrin.h>
+#else
+#define UUIDXX_HAS_X86_SIMD 0
+#endif
+
+namespace uuidxx {
+namespace details {
+
+inline bool cpu_has_avx2() noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+inline bool cpu_has_avx512() noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    static const bool supported = __builtin_cpu_supports("avx512f") &&
+                                  __builtin_cpu_supports("avx512bw") &&
+                                  __builtin_cpu_supports("avx512vl");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+inline void prefetch(const void* ptr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#else
+    (void)ptr;
+#endif
+}
+
+} // namespace details
+} // namespace uuidxx
+
+#endif // UUIDXX_CPU_FEATURES_H_
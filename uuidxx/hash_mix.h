@@ -0,0 +1,30 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_HASH_MIX_H_
+#define UUIDXX_HASH_MIX_H_
+
+#include <cstdint>
+
+namespace uuidxx {
+namespace details {
+
+// Finalizer of MurmurHash3, every input bit affects every output bit.
+constexpr uint64_t mix64(uint64_t k) noexcept {
+    k ^= k >> 33;
+    k *= UINT64_C(0xff51afd7ed558ccd);
+    k ^= k >> 33;
+    k *= UINT64_C(0xc4ceb9fe1a85ec53);
+    k ^= k >> 33;
+    return k;
+}
+
+constexpr uint64_t mix128(uint64_t hi, uint64_t lo) noexcept {
+    return mix64(hi ^ mix64(lo));
+}
+
+} // namespace details
+} // namespace uuidxx
+
+#endif // UUIDXX_HASH_MIX_H_
@@ -13,7 +13,7 @@
 
 namespace uuidxx {
 
-bool load_mac_addr_from_sys(node_id& mac_addr) {
+UUIDXX_INLINE bool load_mac_addr_from_sys(node_id& mac_addr) {
     // Initial buffer size in 16-KB should be enough for most cases, since it's quite
     // expensive to call `GetAdaptersAddresses()`.
     // Also, we leave the `buf` uninitialized to save a few cycles.
@@ -0,0 +1,93 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_MAPPED_FILE_H_
+#define UUIDXX_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+#include "uuidxx/config.h"
+
+namespace uuidxx {
+namespace details {
+
+// A read-write shared mapping of a file, or of shared memory.
+// Stores into a mapped file survive crashes of the process, since pages belong to the
+// page cache; `flush()` additionally makes them survive crashes of the system.
+class mapped_file {
+public:
+    mapped_file() noexcept = default;
+
+    ~mapped_file() {
+        close();
+    }
+
+    mapped_file(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&&) = delete;
+
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file& operator=(mapped_file&&) = delete;
+
+    // Opens the file at `path`, creating it if not exists, and maps its first `size`
+    // bytes; the file is extended with zeros if it is shorter.
+    // Returns false on failure, leaving the object closed.
+    bool open(const std::string& path, std::size_t size);
+
+    // Opens the shared memory object `name`, creating it if not exists, and maps its first
+    // `size` bytes; it is filled with zeros on creation.
+    // The object lives until it is removed by `remove_shared()`, or the system restarts.
+    bool open_shared(const std::string& name, std::size_t size);
+
+    // Maps `size` bytes of zeros, which are shared with child processes created by
+    // `fork()` afterwards.
+    // Always fails on Windows.
+    bool open_anonymous(std::size_t size);
+
+    // Maps the whole file at `path` for reading only; other processes mapping the same
+    // file share its pages in the page cache.
+    // Fails if the file is empty.
+    bool open_read_only(const std::string& path);
+
+    static bool remove_shared(const std::string& name);
+
+    // Writes dirty pages back to the storage device, and waits for completion.
+    bool flush() noexcept;
+
+    void close() noexcept;
+
+    [[nodiscard]] bool is_open() const noexcept {
+        return data_ != nullptr;
+    }
+
+    [[nodiscard]] void* data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    void* data_{nullptr};
+    std::size_t size_{0};
+#if defined(_WIN32)
+    void* file_{nullptr};
+#endif
+};
+
+} // namespace details
+} // namespace uuidxx
+
+#if defined(UUIDXX_HEADER_ONLY)
+#if defined(_WIN32)
+#include "uuidxx/mapped_file_win.cpp" // NOLINT(bugprone-suspicious-include)
+#else
+#include "uuidxx/mapped_file_posix.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+#endif
+
+#endif // UUIDXX_MAPPED_FILE_H_
@@ -0,0 +1,133 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "uuidxx/mapped_file.h"
+
+namespace uuidxx {
+namespace details {
+
+UUIDXX_INLINE bool mapped_file::open(const std::string& path, std::size_t size) {
+    close();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 ||
+        (static_cast<std::size_t>(st.st_size) < size &&
+         ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        ::close(fd);
+        return false;
+    }
+
+    // The mapping holds its own reference to the file.
+    void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::open_shared(const std::string& name, std::size_t size) {
+    close();
+
+    const auto shm_name = "/" + name;
+    const int fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        return false;
+    }
+
+    // Concurrent creators extend it to the same size, which is harmless.
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 ||
+        (static_cast<std::size_t>(st.st_size) < size &&
+         ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::open_anonymous(std::size_t size) {
+    close();
+
+    void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1,
+                        0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::open_read_only(const std::string& path) {
+    close();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    return true;
+}
+
+// static
+UUIDXX_INLINE bool mapped_file::remove_shared(const std::string& name) {
+    const auto shm_name = "/" + name;
+    return ::shm_unlink(shm_name.c_str()) == 0;
+}
+
+UUIDXX_INLINE bool mapped_file::flush() noexcept {
+    return is_open() && ::msync(data_, size_, MS_SYNC) == 0;
+}
+
+UUIDXX_INLINE void mapped_file::close() noexcept {
+    if (is_open()) {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+} // namespace details
+} // namespace uuidxx
@@ -0,0 +1,138 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include <cstdint>
+
+#include <Windows.h>
+
+#include "uuidxx/mapped_file.h"
+
+namespace uuidxx {
+namespace details {
+
+UUIDXX_INLINE bool mapped_file::open(const std::string& path, std::size_t size) {
+    close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // The file is extended if it is shorter than the mapping.
+    const auto size64 = static_cast<uint64_t>(size);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(size64 >> 32),
+                                        static_cast<DWORD>(size64), nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // The view holds its own reference to the mapping.
+    void* addr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    CloseHandle(mapping);
+    if (!addr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    file_ = file;
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::open_shared(const std::string& name, std::size_t size) {
+    close();
+
+    // Backed by the paging file, and filled with zeros on creation.
+    const auto obj_name = "Local\\" + name;
+    const auto size64 = static_cast<uint64_t>(size);
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(size64 >> 32),
+                                        static_cast<DWORD>(size64), obj_name.c_str());
+    if (!mapping) {
+        return false;
+    }
+
+    // Unlike on posix, the object is destroyed once its last handle is closed; so keep
+    // the handle along with the view.
+    void* addr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!addr) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    file_ = mapping;
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::open_anonymous(std::size_t /*size*/) {
+    close();
+    return false;
+}
+
+UUIDXX_INLINE bool mapped_file::open_read_only(const std::string& path) {
+    close();
+
+    // Allows the file to be replaced by renaming while being mapped.
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(file_size.QuadPart);
+    void* addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+    if (!addr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    data_ = addr;
+    size_ = size;
+    file_ = file;
+    return true;
+}
+
+// static
+UUIDXX_INLINE bool mapped_file::remove_shared(const std::string& /*name*/) {
+    return true;
+}
+
+UUIDXX_INLINE bool mapped_file::flush() noexcept {
+    // FlushViewOfFile() doesn't wait for metadata and data in the disk cache.
+    return is_open() && FlushViewOfFile(data_, size_) && FlushFileBuffers(file_);
+}
+
+UUIDXX_INLINE void mapped_file::close() noexcept {
+    if (is_open()) {
+        UnmapViewOfFile(data_);
+        CloseHandle(file_);
+        data_ = nullptr;
+        size_ = 0;
+        file_ = nullptr;
+    }
+}
+
+} // namespace details
+} // namespace uuidxx
@@ -4,36 +4,253 @@
 
 #include "uuidxx/node_fetcher.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
-#include <functional>
+#include <fstream>
 #include <mutex>
+#include <optional>
+#include <utility>
 
+extern "C" {
+#include "hash/sha1.h"
+}
+
+#include "uuidxx/bit_utils.h"
 #include "uuidxx/rand_generator.h"
+#include "uuidxx/stats.h"
 
 namespace uuidxx {
 
-bool load_mac_addr_from_sys(node_id& mac_addr);
+UUIDXX_INLINE bool load_mac_addr_from_sys(node_id& mac_addr);
+
+namespace details {
+
+UUIDXX_INLINE constexpr char k_node_env_name[] = "UUIDXX_NODE";
+
+// Seasoning for hashing machine-id, which should not be exposed as is.
+UUIDXX_INLINE constexpr char k_machine_id_salt[] = "uuidxx-node-id";
+
+// Accepts `xx:xx:xx:xx:xx:xx` and `xx-xx-xx-xx-xx-xx`.
+UUIDXX_INLINE bool parse_node_id(std::string_view str, node_id& id) {
+    constexpr size_t k_node_str_len = 17;
+    if (str.size() != k_node_str_len) {
+        return false;
+    }
+
+    const char sep = str[2];
+    if (sep != ':' && sep != '-') {
+        return false;
+    }
+
+    for (size_t i = 0; i < id.size(); ++i) {
+        auto pos = i * 3;
+        if (i > 0 && str[pos - 1] != sep) {
+            return false;
+        }
+
+        auto high = hex_value(str[pos]);
+        auto low = hex_value(str[pos + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+
+        id[i] = static_cast<std::byte>((high << 4) | low);
+    }
+
+    return true;
+}
+
+UUIDXX_INLINE std::optional<std::string> read_first_line(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    if (!in || !std::getline(in, line)) {
+        return std::nullopt;
+    }
+
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+        line.pop_back();
+    }
+
+    return line;
+}
+
+UUIDXX_INLINE bool load_interface_addr(const std::string& interface, node_id& id) {
+    // Don't let the name escape the directory.
+    if (interface.empty() || interface.find('/') != std::string::npos || interface == "." ||
+        interface == "..") {
+        return false;
+    }
 
-void load_mac_address(node_id& addr) {
-    if (load_mac_addr_from_sys(addr)) {
-        return;
+    auto addr = read_first_line("/sys/class/net/" + interface + "/address");
+    if (!addr || !parse_node_id(*addr, id)) {
+        return false;
     }
 
-    auto rand = details::global_random_generator::instance()();
-    static_assert(sizeof(rand) >= sizeof(addr));
-    std::memcpy(addr.data(), &rand, addr.size());
+    // Virtual adapters without an address, e.g. tunnels, report all-zero.
+    return std::any_of(id.begin(), id.end(), [](std::byte b) { return b != std::byte{0}; });
+}
+
+UUIDXX_INLINE bool load_hashed_machine_id(node_id& id) {
+    auto machine_id = read_first_line("/etc/machine-id");
+    if (!machine_id || machine_id->empty()) {
+        machine_id = read_first_line("/var/lib/dbus/machine-id");
+        if (!machine_id || machine_id->empty()) {
+            return false;
+        }
+    }
+
+    uint8_t digest[SHA1_DIGEST_SIZE];
+    SHA1_CTX ctx;
+    SHA1_Init(&ctx);
+    SHA1_Update(&ctx, reinterpret_cast<const uint8_t*>(k_machine_id_salt),
+                sizeof(k_machine_id_salt) - 1);
+    SHA1_Update(&ctx, reinterpret_cast<const uint8_t*>(machine_id->data()), machine_id->size());
+    SHA1_Final(&ctx, digest);
+
+    std::memcpy(id.data(), digest, id.size());
+
+    // Not a real IEEE 802 address, mark it as RFC recommended.
+    id[0] |= std::byte{0x01};
+
+    return true;
+}
+
+UUIDXX_INLINE void make_random_node(node_id& id) {
+    auto rand = global_random_generator::instance()();
+    static_assert(sizeof(rand) >= sizeof(id));
+    std::memcpy(id.data(), &rand, id.size());
 
     // Recommended by RFC.
-    addr[0] |= std::byte{0x01};
+    id[0] |= std::byte{0x01};
+}
+
+UUIDXX_INLINE std::optional<std::string> read_node_env() {
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t len = 0;
+    if (_dupenv_s(&buf, &len, k_node_env_name) != 0 || buf == nullptr) {
+        return std::nullopt;
+    }
+    std::string value(buf);
+    std::free(buf);
+    return value;
+#else
+    const char* value = std::getenv(k_node_env_name); // NOLINT(concurrency-mt-unsafe)
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    return std::string(value);
+#endif
+}
+
+class node_registry {
+public:
+    static node_registry& instance() {
+        static node_registry instance;
+        return instance;
+    }
+
+    bool set_options(node_options opts) {
+        const std::lock_guard lock(mtx_);
+        if (resolved_) {
+            return false;
+        }
+
+        opts_ = std::move(opts);
+        return true;
+    }
+
+    void read(node_id& id) {
+        std::call_once(once_, &node_registry::resolve, this);
+        std::memcpy(id.data(), node_.data(), node_.size());
+    }
+
+private:
+    node_registry() = default;
+
+    void resolve() {
+        const std::lock_guard lock(mtx_);
+
+        if (!opts_) {
+            node_options env_opts;
+            if (auto spec = read_node_env(); spec && parse_node_options(*spec, env_opts)) {
+                opts_ = std::move(env_opts);
+            } else {
+                opts_ = node_options{};
+            }
+        }
+
+        if (!load(*opts_)) {
+            make_random_node(node_);
+            if (opts_->source != node_source::random) {
+                record_stat(stat_counter::node_random_fallback);
+            }
+        }
+
+        resolved_ = true;
+    }
+
+    bool load(const node_options& opts) {
+        switch (opts.source) {
+        case node_source::system:
+            return load_mac_addr_from_sys(node_);
+        case node_source::explicit_id:
+            node_ = opts.id;
+            return true;
+        case node_source::interface:
+            return load_interface_addr(opts.interface, node_);
+        case node_source::machine_id:
+            return load_hashed_machine_id(node_);
+        case node_source::random:
+            return false;
+        }
+
+        return false;
+    }
+
+private:
+    std::once_flag once_;
+    std::mutex mtx_;
+    std::optional<node_options> opts_;
+    bool resolved_{false};
+    node_id node_{};
+};
+
+} // namespace details
+
+UUIDXX_INLINE bool parse_node_options(std::string_view spec, node_options& opts) {
+    constexpr std::string_view k_if_prefix = "if:";
+
+    node_options parsed;
+    if (spec == "system") {
+        parsed.source = node_source::system;
+    } else if (spec == "machine-id") {
+        parsed.source = node_source::machine_id;
+    } else if (spec == "random") {
+        parsed.source = node_source::random;
+    } else if (spec.substr(0, k_if_prefix.size()) == k_if_prefix) {
+        parsed.source = node_source::interface;
+        parsed.interface = std::string(spec.substr(k_if_prefix.size()));
+        if (parsed.interface.empty()) {
+            return false;
+        }
+    } else if (details::parse_node_id(spec, parsed.id)) {
+        parsed.source = node_source::explicit_id;
+    } else {
+        return false;
+    }
+
+    opts = std::move(parsed);
+    return true;
 }
 
-void read_mac_addr_as_node_id(node_id& id) {
-    // We should load mac address only once in the whole lifetime.
-    static node_id mac_addr;
-    static std::once_flag once;
-    std::call_once(once, load_mac_address, std::ref(mac_addr));
+UUIDXX_INLINE bool set_node_options(node_options opts) {
+    return details::node_registry::instance().set_options(std::move(opts));
+}
 
-    std::memcpy(id.data(), mac_addr.data(), mac_addr.size());
+UUIDXX_INLINE void read_mac_addr_as_node_id(node_id& id) {
+    details::node_registry::instance().read(id);
 }
 
 } // namespace uuidxx
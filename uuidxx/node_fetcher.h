@@ -7,8 +7,12 @@
 
 #include <array>
 #include <cstddef>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
+#include "uuidxx/config.h"
+
 namespace uuidxx {
 
 // A 48-bit device-related identifier.
@@ -22,10 +26,56 @@ struct valid_fetcher_t<Fetcher,
                        std::void_t<decltype(std::decay_t<Fetcher>{}(std::declval<node_id&>()))>>
     : std::true_type {};
 
+enum class node_source {
+    // Scans network adapters and takes the first physical address found.
+    // It may be slow on hosts with lots of virtual adapters, and the result may vary if
+    // adapters come and go.
+    system,
+    // Uses `node_options::id` as is.
+    explicit_id,
+    // Reads /sys/class/net/<node_options::interface>/address; Linux only.
+    interface,
+    // Hashes /etc/machine-id; Linux only.
+    machine_id,
+    // Random per process.
+    random
+};
+
+struct node_options {
+    node_source source{node_source::system};
+    node_id id{};
+    std::string interface;
+};
+
+// Parses node options from a spec, which is one of:
+//  - `system`, `machine-id` or `random`
+//  - `if:<name>` for reading address of the interface
+//  - `xx:xx:xx:xx:xx:xx` or `xx-xx-xx-xx-xx-xx` for an explicit node id
+// Returns false if the spec is malformed.
+bool parse_node_options(std::string_view spec, node_options& opts);
+
+// The node id is resolved only once in the whole lifetime, from, in order of precedence:
+//  1. options set by `set_node_options()`
+//  2. spec in environment variable `UUIDXX_NODE`
+//  3. `node_source::system`
+// If the selected source fails, a random node id is used instead.
+// Returns false if the node id has already been resolved, and `opts` takes no effect.
+bool set_node_options(node_options opts);
+
+// Reads the node id, and resolves it on first call.
 void read_mac_addr_as_node_id(node_id& id);
 
 using mac_addr_reader_t = decltype(read_mac_addr_as_node_id);
 
 } // namespace uuidxx
 
+#if defined(UUIDXX_HEADER_ONLY)
+#include "uuidxx/node_fetcher.cpp" // NOLINT(bugprone-suspicious-include)
+#if defined(_WIN32)
+#include "uuidxx/mac_address_win.cpp" // NOLINT(bugprone-suspicious-include)
+#else
+#include "uuidxx/mac_address_posix.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+#endif
+
 #endif // UUIDXX_NODE_FETCHER_H_
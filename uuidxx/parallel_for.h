@@ -0,0 +1,61 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_PARALLEL_FOR_H_
+#define UUIDXX_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace uuidxx {
+namespace details {
+
+// Joins threads on the way out, including when starting one of them throws.
+struct thread_joiner {
+    std::vector<std::thread>& threads;
+
+    ~thread_joiner() {
+        for (auto& th : threads) {
+            th.join();
+        }
+    }
+};
+
+// Threads to process `count` items with: `threads`, or the number of cores if it is 0; but
+// fewer if each would get fewer than `min_per_thread` items, and at least one.
+inline std::size_t worker_count(std::size_t count, std::size_t threads,
+                                std::size_t min_per_thread) {
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    const auto max_workers = count / std::max<std::size_t>(1, min_per_thread);
+    return std::max<std::size_t>(1, std::min(threads, max_workers));
+}
+
+// Calls `fn(0)` to `fn(workers - 1)` concurrently, `fn(0)` on the calling thread, and
+// returns once all are done.
+template<typename Fn>
+void parallel_for(std::size_t workers, const Fn& fn) {
+    if (workers == 1) {
+        fn(std::size_t{0});
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    const thread_joiner joiner{threads};
+    for (std::size_t i = 1; i < workers; ++i) {
+        threads.emplace_back([&fn, i] { fn(i); });
+    }
+
+    fn(std::size_t{0});
+}
+
+} // namespace details
+} // namespace uuidxx
+
+#endif // UUIDXX_PARALLEL_FOR_H_
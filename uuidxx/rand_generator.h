@@ -9,6 +9,8 @@
 #include <mutex>
 #include <random>
 
+#include "uuidxx/stats.h"
+
 namespace uuidxx {
 
 namespace details {
@@ -37,7 +39,15 @@ public:
     }
 
     uint64_t operator()() {
+#if UUIDXX_ENABLE_STATS
+        std::unique_lock lock(mtx_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            record_stat(stat_counter::rand_lock_contention);
+            lock.lock();
+        }
+#else
         const std::lock_guard lock(mtx_);
+#endif
         return engine_();
     }
 
@@ -0,0 +1,187 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/sorted_uuid_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "uuidxx/bit_utils.h"
+
+namespace uuidxx {
+namespace {
+
+// Ranges this short are left to binary search.
+constexpr std::size_t k_min_interpolation_range = 64;
+
+constexpr int k_max_interpolation_steps = 4;
+
+// Compiles into flag arithmetic, no branches.
+bool less(const uuid::data& lhs, const uuid::data& rhs) noexcept {
+    return (lhs[0] < rhs[0]) | ((lhs[0] == rhs[0]) & (lhs[1] < rhs[1]));
+}
+
+// Number of leading hex digits `lhs` and `rhs` have in common.
+std::size_t common_digits(const uuid::data& lhs, const uuid::data& rhs) noexcept {
+    if (lhs[0] != rhs[0]) {
+        return static_cast<std::size_t>(details::count_leading_zeros(lhs[0] ^ rhs[0]) / 4);
+    }
+
+    if (lhs[1] != rhs[1]) {
+        return 16 + static_cast<std::size_t>(details::count_leading_zeros(lhs[1] ^ rhs[1]) / 4);
+    }
+
+    return sorted_uuid_index::k_max_prefix_length;
+}
+
+} // namespace
+
+sorted_uuid_index::sorted_uuid_index(const uuid* ids, std::size_t count) {
+    ids_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids_.push_back(ids[i].raw_data());
+    }
+
+    std::sort(ids_.begin(), ids_.end());
+    ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+}
+
+std::size_t sorted_uuid_index::lower_bound(const uuid::data& key) const noexcept {
+    const auto* data = ids_.data();
+
+    // The answer is always within [lo, hi].
+    std::size_t lo = 0;
+    std::size_t hi = ids_.size();
+    for (int step = 0; step < k_max_interpolation_steps && hi - lo > k_min_interpolation_range;
+         ++step) {
+        const auto first = data[lo][0];
+        const auto last = data[hi - 1][0];
+        if (key[0] <= first || key[0] > last) {
+            break;
+        }
+
+        // Estimates the position, and checks guards one expected error away on both sides,
+        // which shrink the range to about 2 * sqrt(n) if the estimate is good.
+        const auto n = hi - lo;
+        const auto ratio = static_cast<double>(key[0] - first) / static_cast<double>(last - first);
+        const auto pos = lo + static_cast<std::size_t>(ratio * static_cast<double>(n - 1));
+        const auto gap = static_cast<std::size_t>(std::sqrt(static_cast<double>(n))) + 1;
+
+        bool narrowed = false;
+        if (pos >= lo + gap && less(data[pos - gap], key)) {
+            lo = pos - gap + 1;
+            narrowed = true;
+        }
+
+        if (pos + gap < hi && !less(data[pos + gap], key)) {
+            hi = pos + gap;
+            narrowed = true;
+        }
+
+        if (!narrowed) {
+            break;
+        }
+    }
+
+    // Branchless binary search in [lo, hi].
+    std::size_t len = hi - lo;
+    if (len == 0) {
+        return lo;
+    }
+
+    const auto* base = data + lo;
+    while (len > 1) {
+        const auto half = len / 2;
+        base += less(base[half], key) ? half : 0;
+        len -= half;
+    }
+
+    return static_cast<std::size_t>(base - data) + (less(*base, key) ? 1 : 0);
+}
+
+std::size_t sorted_uuid_index::lower_bound(const uuid& id) const noexcept {
+    return lower_bound(id.raw_data());
+}
+
+std::optional<std::size_t> sorted_uuid_index::find(const uuid& id) const noexcept {
+    const auto& key = id.raw_data();
+    const auto pos = lower_bound(key);
+    if (pos == ids_.size() || ids_[pos] != key) {
+        return std::nullopt;
+    }
+
+    return pos;
+}
+
+std::optional<index_range> sorted_uuid_index::prefix_range(
+        std::string_view prefix) const noexcept {
+    // Smallest and largest ids with the prefix.
+    uuid::data min{0, 0};
+    std::size_t digits = 0;
+    for (char ch : prefix) {
+        if (ch == '-') {
+            continue;
+        }
+
+        const int v = details::hex_value(ch);
+        if (v < 0 || digits == k_max_prefix_length) {
+            return std::nullopt;
+        }
+
+        min[digits / 16] |= static_cast<uint64_t>(v) << ((15 - digits % 16) * 4);
+        ++digits;
+    }
+
+    uuid::data max = min;
+    for (std::size_t i = digits; i < k_max_prefix_length; ++i) {
+        max[i / 16] |= UINT64_C(0xf) << ((15 - i % 16) * 4);
+    }
+
+    const auto first = lower_bound(min);
+
+    // Past `max`, i.e. lower bound of its successor.
+    std::size_t last = ids_.size();
+    if (max[1] != UINT64_MAX) {
+        last = lower_bound(uuid::data{max[0], max[1] + 1});
+    } else if (max[0] != UINT64_MAX) {
+        last = lower_bound(uuid::data{max[0] + 1, 0});
+    }
+
+    return index_range{first, last};
+}
+
+std::optional<uuid> sorted_uuid_index::resolve(std::string_view prefix) const noexcept {
+    auto range = prefix_range(prefix);
+    if (!range || range->size() != 1) {
+        return std::nullopt;
+    }
+
+    return at(range->first);
+}
+
+std::size_t sorted_uuid_index::unique_prefix_length(std::size_t pos) const noexcept {
+    std::size_t common = 0;
+    if (pos > 0) {
+        common = common_digits(ids_[pos - 1], ids_[pos]);
+    }
+
+    if (pos + 1 < ids_.size()) {
+        common = std::max(common, common_digits(ids_[pos], ids_[pos + 1]));
+    }
+
+    // Ids are distinct, thus they differ in at most all 32 digits.
+    return std::min(common + 1, k_max_prefix_length);
+}
+
+void sorted_uuid_index::unique_prefix_lengths(uint8_t* lengths) const noexcept {
+    // Common digits with the predecessor, carried over to the next id.
+    std::size_t prev = 0;
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        const std::size_t next = i + 1 < ids_.size() ? common_digits(ids_[i], ids_[i + 1]) : 0;
+        lengths[i] = static_cast<uint8_t>(std::min(std::max(prev, next) + 1, k_max_prefix_length));
+        prev = next;
+    }
+}
+
+} // namespace uuidxx
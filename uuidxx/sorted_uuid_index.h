@@ -0,0 +1,99 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_SORTED_UUID_INDEX_H_
+#define UUIDXX_SORTED_UUID_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// Positions [first, last) of an index.
+struct index_range {
+    std::size_t first;
+    std::size_t last;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return last - first;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return first == last;
+    }
+};
+
+// An immutable sorted array of distinct uuids, supporting membership tests and lookups by
+// abbreviated ids, like short hashes of git.
+// Lookups interpolate on the high word, which lands next to the target in a couple of
+// probes for random ids, and finish with a branchless binary search; thus skewed ids, e.g.
+// time-based ones, still take O(log n).
+class sorted_uuid_index {
+public:
+    // Max hex digits of a prefix.
+    static constexpr std::size_t k_max_prefix_length = 32;
+
+    sorted_uuid_index() = default;
+
+    // Copies, sorts and removes duplicates of `ids`.
+    sorted_uuid_index(const uuid* ids, std::size_t count);
+
+    explicit sorted_uuid_index(const std::vector<uuid>& ids)
+        : sorted_uuid_index(ids.data(), ids.size()) {}
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return ids_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return ids_.empty();
+    }
+
+    // `pos` must be less than `size()`.
+    [[nodiscard]] uuid at(std::size_t pos) const noexcept {
+        return uuid(ids_[pos], details::gen_from_raw_data);
+    }
+
+    // Position of `id`, if present.
+    [[nodiscard]] std::optional<std::size_t> find(const uuid& id) const noexcept;
+
+    [[nodiscard]] bool contains(const uuid& id) const noexcept {
+        return find(id).has_value();
+    }
+
+    // Position of the first id not less than `id`.
+    [[nodiscard]] std::size_t lower_bound(const uuid& id) const noexcept;
+
+    // Ids whose canonical strings start with `prefix`, in either case; dashes in `prefix`
+    // are ignored, e.g. "6ba7b8109d" and "6BA7B810-9D" are the same.
+    // Returns std::nullopt if `prefix` has anything else than hex digits and dashes, or
+    // has more than `k_max_prefix_length` digits.
+    [[nodiscard]] std::optional<index_range> prefix_range(std::string_view prefix) const noexcept;
+
+    // The only id starting with `prefix`; std::nullopt if there are none, or more than one.
+    [[nodiscard]] std::optional<uuid> resolve(std::string_view prefix) const noexcept;
+
+    // Number of leading hex digits that tells the id at `pos` apart from all others;
+    // dashes are not counted.
+    [[nodiscard]] std::size_t unique_prefix_length(std::size_t pos) const noexcept;
+
+    // Writes `unique_prefix_length()` of every id into `lengths`, which must have room for
+    // `size()` elements.
+    void unique_prefix_lengths(uint8_t* lengths) const noexcept;
+
+private:
+    std::size_t lower_bound(const uuid::data& key) const noexcept;
+
+private:
+    std::vector<uuid::data> ids_;
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_SORTED_UUID_INDEX_H_
@@ -0,0 +1,194 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_STATS_H_
+#define UUIDXX_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "uuidxx/cache_line.h"
+
+// Build with `UUIDXX_ENABLE_STATS` to collect runtime statistics; otherwise every
+// recording point compiles to nothing and `stats()` returns all zeros.
+// `UUIDXX_ENABLE_LATENCY_HISTOGRAM` additionally times each generation.
+#if !defined(UUIDXX_ENABLE_STATS)
+#define UUIDXX_ENABLE_STATS 0
+#endif
+
+#if !defined(UUIDXX_ENABLE_LATENCY_HISTOGRAM)
+#define UUIDXX_ENABLE_LATENCY_HISTOGRAM 0
+#endif
+
+namespace uuidxx {
+
+enum class stat_counter : std::size_t {
+    // `clock_sequence` bumped the sequence, or the shared timestamp, because the clock was
+    // set backward.
+    clock_regression,
+    // `clock_sequence` bumped the sequence, or the shared timestamp, because it was read
+    // twice within one tick.
+    clock_collision,
+    // The global random generator was locked by another thread.
+    rand_lock_contention,
+    // The configured node id source failed, and a random node id was used instead.
+    node_random_fallback,
+    generated_v1,
+    generated_v2,
+    generated_v3,
+    generated_v4,
+    generated_v5,
+    k_count
+};
+
+struct stats_snapshot {
+    static constexpr std::size_t k_histogram_buckets = 32;
+
+    std::array<uint64_t, static_cast<std::size_t>(stat_counter::k_count)> counters{};
+
+    // Bucket `i` counts generations taking [2^i, 2^(i+1)) ns; the last bucket also counts
+    // anything longer.
+    std::array<uint64_t, k_histogram_buckets> latency_histogram{};
+
+    [[nodiscard]] uint64_t get(stat_counter counter) const noexcept {
+        return counters[static_cast<std::size_t>(counter)];
+    }
+};
+
+namespace details {
+
+// Threads are spread over shards to keep counters from bouncing between cores.
+class stats_shard {
+public:
+    static constexpr std::size_t k_count = 16;
+
+    void add(stat_counter counter, uint64_t n = 1) noexcept {
+        counters_[static_cast<std::size_t>(counter)].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void add_latency(std::chrono::nanoseconds elapsed) noexcept {
+        std::size_t bucket = 0;
+        for (auto ns = static_cast<uint64_t>(elapsed.count()); ns > 1; ns >>= 1) {
+            ++bucket;
+        }
+
+        bucket = bucket < stats_snapshot::k_histogram_buckets
+                         ? bucket
+                         : stats_snapshot::k_histogram_buckets - 1;
+        histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void collect(stats_snapshot& snapshot) const noexcept {
+        for (std::size_t i = 0; i < counters_.size(); ++i) {
+            snapshot.counters[i] += counters_[i].load(std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < histogram_.size(); ++i) {
+            snapshot.latency_histogram[i] += histogram_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    void reset() noexcept {
+        for (auto& counter : counters_) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+
+        for (auto& bucket : histogram_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    alignas(k_cache_line_size) std::array<std::atomic<uint64_t>,
+                                          static_cast<std::size_t>(stat_counter::k_count)>
+            counters_{};
+    std::array<std::atomic<uint64_t>, stats_snapshot::k_histogram_buckets> histogram_{};
+};
+
+#if UUIDXX_ENABLE_STATS
+
+// Constant-initialized, thus no guard on access.
+inline stats_shard g_stats_shards[stats_shard::k_count];
+inline std::atomic<std::size_t> g_next_stats_shard{0};
+inline thread_local std::size_t t_stats_shard = stats_shard::k_count;
+
+inline stats_shard& local_stats_shard() noexcept {
+    if (t_stats_shard == stats_shard::k_count) {
+        t_stats_shard = g_next_stats_shard.fetch_add(1, std::memory_order_relaxed) %
+                        stats_shard::k_count;
+    }
+
+    return g_stats_shards[t_stats_shard];
+}
+
+#endif
+
+inline void record_stat(stat_counter counter, uint64_t n = 1) noexcept {
+#if UUIDXX_ENABLE_STATS
+    local_stats_shard().add(counter, n);
+#else
+    (void)counter;
+    (void)n;
+#endif
+}
+
+// Records elapsed time of its lifetime into the latency histogram, along with `counter`.
+class scoped_generation_stat {
+public:
+    explicit scoped_generation_stat(stat_counter counter) noexcept
+#if UUIDXX_ENABLE_STATS && UUIDXX_ENABLE_LATENCY_HISTOGRAM
+        : start_(std::chrono::steady_clock::now())
+#endif
+    {
+        record_stat(counter);
+    }
+
+    ~scoped_generation_stat() {
+#if UUIDXX_ENABLE_STATS && UUIDXX_ENABLE_LATENCY_HISTOGRAM
+        local_stats_shard().add_latency(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_));
+#endif
+    }
+
+    scoped_generation_stat(const scoped_generation_stat&) = delete;
+
+    scoped_generation_stat(scoped_generation_stat&&) = delete;
+
+    scoped_generation_stat& operator=(const scoped_generation_stat&) = delete;
+
+    scoped_generation_stat& operator=(scoped_generation_stat&&) = delete;
+
+private:
+#if UUIDXX_ENABLE_STATS && UUIDXX_ENABLE_LATENCY_HISTOGRAM
+    std::chrono::steady_clock::time_point start_;
+#endif
+};
+
+} // namespace details
+
+// Sums up all shards; counters keep growing until `reset_stats()`.
+inline stats_snapshot stats() noexcept {
+    stats_snapshot snapshot;
+#if UUIDXX_ENABLE_STATS
+    for (const auto& shard : details::g_stats_shards) {
+        shard.collect(snapshot);
+    }
+#endif
+    return snapshot;
+}
+
+inline void reset_stats() noexcept {
+#if UUIDXX_ENABLE_STATS
+    for (auto& shard : details::g_stats_shards) {
+        shard.reset();
+    }
+#endif
+}
+
+} // namespace uuidxx
+
+#endif // UUIDXX_STATS_H_
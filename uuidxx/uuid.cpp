@@ -4,7 +4,6 @@
 
 #include "uuidxx/uuid.h"
 
-#include <charconv>
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
@@ -14,14 +13,16 @@ extern "C" {
 #include "hash/sha1.h"
 }
 
+#include "uuidxx/bit_utils.h"
 #include "uuidxx/endian_utils.h"
 
 namespace uuidxx {
-namespace {
+namespace details {
 
-constexpr size_t k_canonical_len = 36;
+UUIDXX_INLINE constexpr size_t k_canonical_len = 36;
 
-void md5_hash(const uuid::data& ns_data, std::string_view name, uuid::data& hashed_data) {
+UUIDXX_INLINE void md5_hash(const uuid::data& ns_data, std::string_view name,
+                            uuid::data& hashed_data) {
     MD5_CTX ctx;
     MD5_Init(&ctx);
     MD5_Update(&ctx, ns_data.data(), sizeof(ns_data));
@@ -30,7 +31,8 @@ void md5_hash(const uuid::data& ns_data, std::string_view name, uuid::data& hash
     MD5_Final(reinterpret_cast<unsigned char*>(hashed_data.data()), &ctx);
 }
 
-void sha1_hash(const uuid::data& ns_data, std::string_view name, uuid::data& hashed_data) {
+UUIDXX_INLINE void sha1_hash(const uuid::data& ns_data, std::string_view name,
+                             uuid::data& hashed_data) {
     uint8_t digest[20];
 
     SHA1_CTX ctx;
@@ -55,29 +57,53 @@ void hash_named_data_to_uuid_data(const uuid& ns, std::string_view name, uuid::d
     out[1] = byteswap(out[1]);
 }
 
-// Strip enclosing braces if possible and do quick format check.
-std::string_view canonicalize_uuid_str(std::string_view input) {
+// Branch-free on digits; `bad` turns negative if any of [first, last) is not hexadecimal.
+UUIDXX_INLINE uint64_t parse_hex(const char* first, const char* last, int& bad) noexcept {
+    uint64_t value = 0;
+    for (; first != last; ++first) {
+        const int digit = k_hex_table[static_cast<unsigned char>(*first)];
+        bad |= digit;
+        value = (value << 4) | static_cast<uint64_t>(digit & 0x0f);
+    }
+    return value;
+}
+
+UUIDXX_INLINE uuid_errc parse_uuid_str(std::string_view input, uuid::data& out) noexcept {
     auto uuid_str = input;
     if (uuid_str.size() == k_canonical_len + 2) {
         if (uuid_str.front() != '{' || uuid_str.back() != '}') {
-            throw bad_uuid_string(input);
+            return uuid_errc::invalid_format;
         }
 
         uuid_str = uuid_str.substr(1, k_canonical_len);
     }
 
-    if ((uuid_str.size() != k_canonical_len) ||
-        (uuid_str[8] != '-' || uuid_str[13] != '-' ||
-         uuid_str[18] != '-' || uuid_str[23] != '-')) {
-        throw bad_uuid_string(input);
+    if (uuid_str.size() != k_canonical_len) {
+        return uuid_errc::invalid_length;
+    }
+
+    if (uuid_str[8] != '-' || uuid_str[13] != '-' || uuid_str[18] != '-' ||
+        uuid_str[23] != '-') {
+        return uuid_errc::invalid_format;
+    }
+
+    const auto* str = uuid_str.data();
+    int bad = 0;
+    uuid::data raw;
+    raw[0] = (parse_hex(str, str + 8, bad) << 32) | (parse_hex(str + 9, str + 13, bad) << 16) |
+             parse_hex(str + 14, str + 18, bad);
+    raw[1] = (parse_hex(str + 19, str + 23, bad) << 48) | parse_hex(str + 24, str + 36, bad);
+    if (bad < 0) {
+        return uuid_errc::invalid_digit;
     }
 
-    return uuid_str;
+    out = raw;
+    return uuid_errc{};
 }
 
-} // namespace
+} // namespace details
 
-uuid::uuid(host_id host, details::gen_v2_t) {
+UUIDXX_INLINE uuid::uuid(host_id host, details::gen_v2_t) {
     // Need high 32-bit of ts and high 8-bit of seq.
     auto [ts, seq] = clock_sequence::instance().read();
 
@@ -106,52 +132,33 @@ uuid::uuid(host_id host, details::gen_v2_t) {
     set_version(version::v2);
 }
 
-uuid::uuid(const uuid& ns, std::string_view name, details::gen_v3_t) {
-    hash_named_data_to_uuid_data(ns, name, data_, md5_hash);
+UUIDXX_INLINE uuid::uuid(const uuid& ns, std::string_view name, details::gen_v3_t) {
+    details::hash_named_data_to_uuid_data(ns, name, data_, details::md5_hash);
 
     set_variant();
     set_version(version::v3);
 }
 
-uuid::uuid(const uuid& ns, std::string_view name, details::gen_v5_t) {
-    hash_named_data_to_uuid_data(ns, name, data_, sha1_hash);
+UUIDXX_INLINE uuid::uuid(const uuid& ns, std::string_view name, details::gen_v5_t) {
+    details::hash_named_data_to_uuid_data(ns, name, data_, details::sha1_hash);
 
     set_variant();
     set_version(version::v5);
 }
 
-uuid::uuid(std::string_view src, details::gen_from_str_t) {
-    auto uuid_str = canonicalize_uuid_str(src);
-
-    auto cvt = [uuid_str](size_t first, size_t last) -> uint64_t {
-        auto begin = uuid_str.data() + first;
-        auto end = uuid_str.data() + last;
-
-        uint64_t value{0};
-        if (auto result = std::from_chars(begin, end, value, 16); result.ec != std::errc()) {
-            throw bad_uuid_string(uuid_str);
-        }
-
-        return value;
-    };
-
-    std::array<uint64_t, 5> parts{cvt(0, 8), cvt(9, 13), cvt(14, 18), cvt(19, 23), cvt(24, 36)};
-
-    data_[0] |= parts[0] << 32;
-    data_[0] |= parts[1] << 16;
-    data_[0] |= parts[2];
-
-    data_[1] |= parts[3] << 48;
-    data_[1] |= parts[4];
+UUIDXX_INLINE uuid::uuid(std::string_view src, details::gen_from_str_t) {
+    if (details::parse_uuid_str(src, data_) != uuid_errc{}) {
+        details::throw_bad_uuid_string(src);
+    }
 }
 
-std::string uuid::to_string() const {
-    std::string s(k_canonical_len + 1, 0);
+UUIDXX_INLINE std::string uuid::to_string() const {
+    std::string s(details::k_canonical_len + 1, 0);
     constexpr char fmt[] = "%08" PRIx64 "-%04" PRIx64 "-%04" PRIx64 "-%04" PRIx64 "-%012" PRIx64;
     std::snprintf(s.data(), s.size(), fmt,
                   data_[0] >> 32, (data_[0] >> 16) & 0xffff, data_[0] & 0xffff,
                   data_[1] >> 48, data_[1] & UINT64_C(0xffff'ffff'ffff));
-    s.resize(k_canonical_len);
+    s.resize(details::k_canonical_len);
     return s;
 }
 
@@ -6,15 +6,22 @@
 #define UUIDXX_UUID_H_
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <exception>
+#include <functional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
 #include "uuidxx/clock_sequence.h"
+#include "uuidxx/config.h"
 #include "uuidxx/dce_host_identifier.h"
+#include "uuidxx/hash_mix.h"
 #include "uuidxx/node_fetcher.h"
+#include "uuidxx/uuid_error.h"
 
 namespace uuidxx {
 namespace details {
@@ -47,6 +54,10 @@ struct gen_from_data_bytes_t {
     explicit gen_from_data_bytes_t() = default;
 };
 
+struct gen_from_raw_data_t {
+    explicit gen_from_raw_data_t() = default;
+};
+
 inline constexpr gen_v1_t gen_v1{};
 inline constexpr gen_v2_t gen_v2{};
 inline constexpr gen_v3_t gen_v3{};
@@ -54,6 +65,7 @@ inline constexpr gen_v4_t gen_v4{};
 inline constexpr gen_v5_t gen_v5{};
 inline constexpr gen_from_str_t gen_from_str{};
 inline constexpr gen_from_data_bytes_t gen_from_data_bytes{};
+inline constexpr gen_from_raw_data_t gen_from_raw_data{};
 
 } // namespace details
 
@@ -65,8 +77,39 @@ inline constexpr uint8_t v3 = 3U;
 inline constexpr uint8_t v4 = 4U;
 inline constexpr uint8_t v5 = 5U;
 
+// Defined by RFC 9562; only decoded, not generated.
+inline constexpr uint8_t v6 = 6U;
+inline constexpr uint8_t v7 = 7U;
+
+// Custom layouts, see `v8_layout`.
+inline constexpr uint8_t v8 = 8U;
+
 } // namespace version
 
+enum class uuid_variant : uint8_t {
+    // Reserved, NCS backward compatibility; 0xx.
+    ncs,
+    // RFC 4122 / RFC 9562; 10x.
+    rfc4122,
+    // Reserved, Microsoft backward compatibility; 110.
+    microsoft,
+    // Reserved for future definition; 111.
+    future
+};
+
+// Time points in 100ns intervals since Unix epoch, the resolution of time-based uuids.
+using uuid_timestamp =
+        std::chrono::time_point<std::chrono::system_clock,
+                                std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>>;
+
+namespace details {
+
+// Difference in 100ns intervals between UUID epoch (1582/10/15 00:00:00) and Unix
+// epoch (1970/01/01 00:00:00)
+inline constexpr int64_t k_uuid_epoch_offset = 122192928000000000;
+
+} // namespace details
+
 class bad_uuid_string : public std::invalid_argument {
 public:
     explicit bad_uuid_string(std::string_view uuid_str)
@@ -79,6 +122,19 @@ public:
     }
 };
 
+namespace details {
+
+[[noreturn]] inline void throw_bad_uuid_string(std::string_view uuid_str) {
+#if UUIDXX_NO_EXCEPTIONS
+    (void)uuid_str;
+    std::abort();
+#else
+    throw bad_uuid_string(uuid_str);
+#endif
+}
+
+} // namespace details
+
 struct data_bytes {
     uint32_t field1;
     uint16_t field2;
@@ -120,21 +176,12 @@ public:
         node_id id;
         fetch(id);
 
-        data_[0] |= ts << 32;
-        data_[0] |= (ts & UINT64_C(0x0000'ffff'0000'0000)) >> 16;
-        data_[0] |= ts >> 48;
-
-        data_[1] |= static_cast<uint64_t>(seq & 0xff00) << 48;
-        data_[1] |= static_cast<uint64_t>(seq & 0xff) << 48;
-
-        // Reversely copy into 0 ~ 47 bits of data_[1].
-        auto ptr = reinterpret_cast<std::byte*>(&data_[1]);
-        for (auto it = id.rbegin(); it != id.rend();) {
-            *ptr++ = *it++;
-        }
+        assign_v1(ts, seq, id);
+    }
 
-        set_variant();
-        set_version(version::v1);
+    // `ts` is in 100ns intervals since UUID epoch, as `clock_sequence` reads.
+    uuid(uint64_t ts, uint16_t seq, const node_id& node, details::gen_v1_t) {
+        assign_v1(ts, seq, node);
     }
 
     uuid(host_id host, details::gen_v2_t);
@@ -166,6 +213,9 @@ public:
         }
     }
 
+    constexpr uuid(const data& raw, details::gen_from_raw_data_t)
+        : data_(raw) {}
+
     uuid(const uuid&) = default;
 
     uuid(uuid&&) = default;
@@ -180,14 +230,101 @@ public:
         return static_cast<uint8_t>((data_[0] >> 12) & 0x0f);
     }
 
+    [[nodiscard]] uuid_variant variant() const noexcept {
+        auto bits = data_[1] >> 61;
+        if ((bits & 0b100) == 0) {
+            return uuid_variant::ncs;
+        }
+
+        if ((bits & 0b110) == 0b100) {
+            return uuid_variant::rfc4122;
+        }
+
+        return bits == 0b110 ? uuid_variant::microsoft : uuid_variant::future;
+    }
+
+    // True if it is of RFC variant and a version defined by RFC 9562.
+    [[nodiscard]] bool is_valid_rfc() const noexcept {
+        auto ver = version();
+        return (data_[1] >> 62) == 0b10 && ver >= 1 && ver <= 8;
+    }
+
+    // Creation time of v1, v2, v6 and v7; Unix epoch for other versions.
+    // Low 32 bits of the timestamp of v2 are replaced by local id, thus it is accurate
+    // only to about 7 minutes.
+    [[nodiscard]] uuid_timestamp timestamp() const noexcept {
+        int64_t ticks = 0;
+        switch (version()) {
+        case version::v1:
+            ticks = static_cast<int64_t>(((data_[0] & 0x0fff) << 48) |
+                                         (((data_[0] >> 16) & 0xffff) << 32) | (data_[0] >> 32)) -
+                    details::k_uuid_epoch_offset;
+            break;
+        case version::v2:
+            ticks = static_cast<int64_t>(((data_[0] & 0x0fff) << 48) |
+                                         (((data_[0] >> 16) & 0xffff) << 32)) -
+                    details::k_uuid_epoch_offset;
+            break;
+        case version::v6:
+            ticks = static_cast<int64_t>(((data_[0] >> 16) << 12) | (data_[0] & 0x0fff)) -
+                    details::k_uuid_epoch_offset;
+            break;
+        case version::v7:
+            ticks = static_cast<int64_t>(data_[0] >> 16) * 10'000;
+            break;
+        default:
+            break;
+        }
+
+        return uuid_timestamp(uuid_timestamp::duration(ticks));
+    }
+
+    // Clock sequence of v1, v2 and v6; 0 for other versions.
+    // Only high 6 bits are meaningful for v2, the rest is local domain.
+    [[nodiscard]] uint16_t clock_seq() const noexcept {
+        auto ver = version();
+        if (ver != version::v1 && ver != version::v2 && ver != version::v6) {
+            return 0;
+        }
+
+        return static_cast<uint16_t>((data_[1] >> 48) & 0x3fff);
+    }
+
+    // Low 48 bits, which is the node id for v1, v2 and v6.
+    [[nodiscard]] node_id node() const noexcept {
+        node_id id;
+        for (std::size_t i = 0; i < id.size(); ++i) {
+            id[i] = static_cast<std::byte>(data_[1] >> ((id.size() - 1 - i) * 8));
+        }
+        return id;
+    }
+
     [[nodiscard]] std::string to_string() const;
 
     // The value is implementation defined.
-    const data& raw_data() const noexcept {
+    constexpr const data& raw_data() const noexcept {
         return data_;
     }
 
 private:
+    void assign_v1(uint64_t ts, uint16_t seq, const node_id& node) noexcept {
+        data_[0] |= ts << 32;
+        data_[0] |= (ts & UINT64_C(0x0000'ffff'0000'0000)) >> 16;
+        data_[0] |= ts >> 48;
+
+        data_[1] |= static_cast<uint64_t>(seq & 0xff00) << 48;
+        data_[1] |= static_cast<uint64_t>(seq & 0xff) << 48;
+
+        // Reversely copy into 0 ~ 47 bits of data_[1].
+        auto ptr = reinterpret_cast<std::byte*>(&data_[1]);
+        for (auto it = node.rbegin(); it != node.rend();) {
+            *ptr++ = *it++;
+        }
+
+        set_variant();
+        set_version(version::v1);
+    }
+
     // The RFC 4122 has only one variant.
     void set_variant() noexcept {
         data_[1] &= UINT64_C(0x3fff'ffff'ffff'ffff);
@@ -204,6 +341,13 @@ private:
     data data_{0};
 };
 
+namespace details {
+
+// Parses the formats `make_from()` accepts into `out`, and leaves it intact on failure.
+uuid_errc parse_uuid_str(std::string_view input, uuid::data& out) noexcept;
+
+} // namespace details
+
 inline bool operator==(const uuid& lhs, const uuid& rhs) {
     return lhs.raw_data() == rhs.raw_data();
 }
@@ -212,6 +356,39 @@ inline bool operator!=(const uuid& lhs, const uuid& rhs) {
     return !(lhs == rhs);
 }
 
+// Ordering is consistent with lexicographical order of canonical strings.
+inline bool operator<(const uuid& lhs, const uuid& rhs) {
+    return lhs.raw_data() < rhs.raw_data();
+}
+
+inline bool operator>(const uuid& lhs, const uuid& rhs) {
+    return rhs < lhs;
+}
+
+inline bool operator<=(const uuid& lhs, const uuid& rhs) {
+    return !(rhs < lhs);
+}
+
+inline bool operator>=(const uuid& lhs, const uuid& rhs) {
+    return !(lhs < rhs);
+}
+
 } // namespace uuidxx
 
+namespace std {
+
+template<>
+struct hash<uuidxx::uuid> {
+    size_t operator()(const uuidxx::uuid& id) const noexcept {
+        const auto& raw = id.raw_data();
+        return static_cast<size_t>(uuidxx::details::mix128(raw[0], raw[1]));
+    }
+};
+
+} // namespace std
+
+#if defined(UUIDXX_HEADER_ONLY)
+#include "uuidxx/uuid.cpp" // NOLINT(bugprone-suspicious-include)
+#endif
+
 #endif // UUIDXX_UUID_H_
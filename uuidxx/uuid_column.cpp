@@ -0,0 +1,192 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_column.h"
+
+#include <algorithm>
+
+namespace uuidxx {
+namespace {
+
+uint8_t bit_width(uint64_t n) noexcept {
+    uint8_t width = 0;
+    while (n != 0) {
+        ++width;
+        n >>= 1;
+    }
+    return width;
+}
+
+// Returns 0 for 0, to not shift away anything.
+uint8_t trailing_zeros(uint64_t n) noexcept {
+    if (n == 0) {
+        return 0;
+    }
+
+    uint8_t count = 0;
+    while ((n & 1) == 0) {
+        ++count;
+        n >>= 1;
+    }
+    return count;
+}
+
+class bit_writer {
+public:
+    explicit bit_writer(std::vector<uint64_t>& words)
+        : words_(words),
+          base_(words.size()) {}
+
+    void write(uint64_t value, unsigned width) {
+        if (width == 0) {
+            return;
+        }
+
+        auto idx = base_ + pos_ / 64;
+        auto shift = static_cast<unsigned>(pos_ % 64);
+        if (idx >= words_.size()) {
+            words_.push_back(0);
+        }
+
+        words_[idx] |= value << shift;
+        if (shift + width > 64) {
+            words_.push_back(value >> (64 - shift));
+        }
+
+        pos_ += width;
+    }
+
+private:
+    std::vector<uint64_t>& words_;
+    std::size_t base_;
+    std::size_t pos_{0};
+};
+
+} // namespace
+
+uuid_column::uuid_column(const uuid* ids, std::size_t count)
+    : size_(count) {
+    blocks_.reserve((count + k_block_size - 1) / k_block_size);
+    for (std::size_t i = 0; i < count; i += k_block_size) {
+        append_block(ids + i, std::min(k_block_size, count - i));
+    }
+
+    blocks_.shrink_to_fit();
+    words_.shrink_to_fit();
+}
+
+void uuid_column::append_block(const uuid* ids, std::size_t count) {
+    block blk{};
+    blk.min = ids[0].raw_data();
+    blk.max = ids[count - 1].raw_data();
+    blk.offset = words_.size();
+    blk.count = static_cast<uint32_t>(count);
+
+    uint64_t lo_min = ids[0].raw_data()[1];
+    for (std::size_t i = 1; i < count; ++i) {
+        lo_min = std::min(lo_min, ids[i].raw_data()[1]);
+    }
+
+    // Bits below the lowest varying bit are common in the block, e.g. time_mid and
+    // time_hi of v1 ids sorted by time_low, or node of v1 ids; shift them away.
+    uint64_t max_delta = 0;
+    uint64_t delta_bits = 0;
+    uint64_t max_offset = 0;
+    uint64_t offset_bits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& raw = ids[i].raw_data();
+        if (i > 0) {
+            auto delta = raw[0] - ids[i - 1].raw_data()[0];
+            max_delta = std::max(max_delta, delta);
+            delta_bits |= delta;
+        }
+
+        auto offset = raw[1] - lo_min;
+        max_offset = std::max(max_offset, offset);
+        offset_bits |= offset;
+    }
+
+    blk.hi_shift = trailing_zeros(delta_bits);
+    blk.hi_bits = bit_width(max_delta >> blk.hi_shift);
+    blk.lo_shift = trailing_zeros(offset_bits);
+    blk.lo_bits = bit_width(max_offset >> blk.lo_shift);
+    blk.lo_base = lo_min;
+
+    bit_writer writer(words_);
+    for (std::size_t i = 1; i < count; ++i) {
+        writer.write((ids[i].raw_data()[0] - ids[i - 1].raw_data()[0]) >> blk.hi_shift,
+                     blk.hi_bits);
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        writer.write((ids[i].raw_data()[1] - lo_min) >> blk.lo_shift, blk.lo_bits);
+    }
+
+    blocks_.push_back(blk);
+}
+
+bool uuid_column::contains(const uuid& id) const noexcept {
+    const auto& key = id.raw_data();
+
+    // The last block whose min is not greater than the key.
+    auto it = std::upper_bound(blocks_.begin(), blocks_.end(), key,
+                               [](const uuid::data& k, const block& blk) { return k < blk.min; });
+    if (it == blocks_.begin()) {
+        return false;
+    }
+
+    const auto& blk = *--it;
+    if (blk.max < key) {
+        return false;
+    }
+
+    uint64_t hi = blk.min[0];
+    for (std::size_t i = 0; i < blk.count; ++i) {
+        if (i > 0) {
+            hi += hi_delta_at(blk, i);
+        }
+
+        if (hi > key[0]) {
+            return false;
+        }
+
+        if (hi == key[0]) {
+            auto lo = lo_at(blk, i);
+            if (lo >= key[1]) {
+                return lo == key[1];
+            }
+        }
+    }
+
+    return false;
+}
+
+uuid_column::const_iterator::const_iterator(const uuid_column* col, std::size_t block) noexcept
+    : col_(col),
+      block_(block) {
+    if (block_ < col_->blocks_.size()) {
+        hi_ = col_->blocks_[block_].min[0];
+    }
+}
+
+uuid uuid_column::const_iterator::operator*() const noexcept {
+    const auto& blk = col_->blocks_[block_];
+    return make_from_raw_data(uuid::data{hi_, col_->lo_at(blk, idx_)});
+}
+
+uuid_column::const_iterator& uuid_column::const_iterator::operator++() noexcept {
+    const auto& blk = col_->blocks_[block_];
+    if (++idx_ == blk.count) {
+        idx_ = 0;
+        if (++block_ < col_->blocks_.size()) {
+            hi_ = col_->blocks_[block_].min[0];
+        }
+        return *this;
+    }
+
+    hi_ += col_->hi_delta_at(blk, idx_);
+    return *this;
+}
+
+} // namespace uuidxx
@@ -0,0 +1,163 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_COLUMN_H_
+#define UUIDXX_UUID_COLUMN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "uuidxx/uuidxx.h"
+
+namespace uuidxx {
+namespace details {
+
+// Reads `width` bits starting at bit `pos`; `width` is in [0, 64].
+inline uint64_t read_packed(const uint64_t* words, std::size_t pos, unsigned width) noexcept {
+    if (width == 0) {
+        return 0;
+    }
+
+    auto idx = pos / 64;
+    auto shift = static_cast<unsigned>(pos % 64);
+    uint64_t value = words[idx] >> shift;
+    if (shift + width > 64) {
+        value |= words[idx + 1] << (64 - shift);
+    }
+
+    return width == 64 ? value : value & ((UINT64_C(1) << width) - 1);
+}
+
+} // namespace details
+
+// A read-only container of sorted uuids, compressed in blocks.
+// In each block, the high word, i.e. `raw_data()[0]`, which carries timestamp for
+// time-based versions, is delta-encoded; and the low word is frame-of-reference encoded.
+// Both are bit-packed with the minimum width of the block, after stripping low bits that
+// are common to the whole block.
+// Thus time-ordered ids from a few nodes take only a fraction of 16 bytes, while random
+// bits are effectively kept verbatim.
+class uuid_column {
+public:
+    static constexpr std::size_t k_block_size = 128;
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uuid;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = uuid;
+
+        const_iterator() = default;
+
+        uuid operator*() const noexcept;
+
+        const_iterator& operator++() noexcept;
+
+        const_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.block_ == rhs.block_ && lhs.idx_ == rhs.idx_;
+        }
+
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class uuid_column;
+
+        const_iterator(const uuid_column* col, std::size_t block) noexcept;
+
+    private:
+        const uuid_column* col_{nullptr};
+        std::size_t block_{0};
+        std::size_t idx_{0};
+        uint64_t hi_{0};
+    };
+
+    using iterator = const_iterator;
+
+    uuid_column() = default;
+
+    // `ids` must be sorted in ascending order.
+    uuid_column(const uuid* ids, std::size_t count);
+
+    explicit uuid_column(const std::vector<uuid>& ids)
+        : uuid_column(ids.data(), ids.size()) {}
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Skips blocks by their min/max, and scans packed bits of only one block.
+    [[nodiscard]] bool contains(const uuid& id) const noexcept;
+
+    // Bytes taken by the compressed representation.
+    [[nodiscard]] std::size_t memory_usage() const noexcept {
+        return blocks_.capacity() * sizeof(block) + words_.capacity() * sizeof(uint64_t);
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return const_iterator(this, blocks_.size());
+    }
+
+private:
+    struct block {
+        uuid::data min;
+        uuid::data max;
+        uint64_t lo_base;
+        // Offset into `words_`; payload is (count - 1) hi deltas followed by count lo
+        // offsets.
+        std::size_t offset;
+        uint32_t count;
+        uint8_t hi_bits;
+        uint8_t hi_shift;
+        uint8_t lo_bits;
+        uint8_t lo_shift;
+    };
+
+    void append_block(const uuid* ids, std::size_t count);
+
+    const uint64_t* payload(const block& blk) const noexcept {
+        return words_.data() + blk.offset;
+    }
+
+    // Delta between the high word of `idx` and its predecessor; `idx` > 0.
+    uint64_t hi_delta_at(const block& blk, std::size_t idx) const noexcept {
+        return details::read_packed(payload(blk), (idx - 1) * blk.hi_bits, blk.hi_bits)
+               << blk.hi_shift;
+    }
+
+    uint64_t lo_at(const block& blk, std::size_t idx) const noexcept {
+        auto lo_start = static_cast<std::size_t>(blk.count - 1) * blk.hi_bits;
+        return blk.lo_base +
+               (details::read_packed(payload(blk), lo_start + idx * blk.lo_bits, blk.lo_bits)
+                << blk.lo_shift);
+    }
+
+private:
+    std::vector<block> blocks_;
+    std::vector<uint64_t> words_;
+    std::size_t size_{0};
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_COLUMN_H_
@@ -0,0 +1,71 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_ERROR_H_
+#define UUIDXX_UUID_ERROR_H_
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace uuidxx {
+
+// Failures of the non-throwing APIs, reported as `std::error_code`; 0 means success, as
+// with `std::errc`.
+enum class uuid_errc : uint8_t {
+    // Strings are neither 36 characters, nor 38 with braces; or bytes are not 16.
+    invalid_length = 1,
+    // Braces or dashes are misplaced.
+    invalid_format,
+    // A digit is not hexadecimal.
+    invalid_digit,
+    // The name of a v3 or v5 uuid exceeds the limit.
+    name_too_long,
+};
+
+namespace details {
+
+class uuid_error_category : public std::error_category {
+public:
+    const char* name() const noexcept override {
+        return "uuidxx";
+    }
+
+    std::string message(int ev) const override {
+        switch (static_cast<uuid_errc>(ev)) {
+        case uuid_errc::invalid_length:
+            return "invalid uuid length";
+        case uuid_errc::invalid_format:
+            return "invalid uuid format";
+        case uuid_errc::invalid_digit:
+            return "invalid hexadecimal digit in uuid";
+        case uuid_errc::name_too_long:
+            return "uuid name too long";
+        }
+        return "unknown uuidxx error";
+    }
+};
+
+} // namespace details
+
+inline const std::error_category& uuid_category() noexcept {
+    static const details::uuid_error_category category;
+    return category;
+}
+
+inline std::error_code make_error_code(uuid_errc e) noexcept {
+    return {static_cast<int>(e), uuid_category()};
+}
+
+} // namespace uuidxx
+
+namespace std {
+
+template<>
+struct is_error_code_enum<uuidxx::uuid_errc> : true_type {};
+
+} // namespace std
+
+#endif // UUIDXX_UUID_ERROR_H_
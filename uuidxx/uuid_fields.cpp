@@ -0,0 +1,83 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_fields.h"
+
+#include "uuidxx/cpu_features.h"
+
+namespace uuidxx {
+namespace {
+
+static_assert(sizeof(uuid) == sizeof(uuid::data));
+
+#if UUIDXX_HAS_X86_SIMD
+
+// Returns number of ids processed; the tail is left to the scalar loop.
+UUIDXX_TARGET_AVX2 std::size_t extract_timestamps_avx2(const uuid* ids, std::size_t count,
+                                                       uuid_timestamp* out) noexcept {
+    const __m256i low12 = _mm256_set1_epi64x(0x0fff);
+    const __m256i low16 = _mm256_set1_epi64x(0xffff);
+    const __m256i epoch = _mm256_set1_epi64x(details::k_uuid_epoch_offset);
+    const __m256i ms_to_ticks = _mm256_set1_epi64x(10'000);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // [id0.hi, id0.lo, id1.hi, id1.lo] and [id2.hi, id2.lo, id3.hi, id3.lo]
+        auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+        auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i + 2));
+        // [id0.hi, id2.hi, id1.hi, id3.hi] -> [id0.hi, id1.hi, id2.hi, id3.hi]
+        auto hi = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0b11'01'10'00);
+
+        auto ver = _mm256_and_si256(_mm256_srli_epi64(hi, 12), _mm256_set1_epi64x(0x0f));
+
+        // time_hi << 48 | time_mid << 32, which is also the timestamp of v2.
+        auto ts_hi_mid = _mm256_or_si256(
+                _mm256_slli_epi64(_mm256_and_si256(hi, low12), 48),
+                _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(hi, 16), low16), 32));
+        auto ts1 = _mm256_sub_epi64(_mm256_or_si256(ts_hi_mid, _mm256_srli_epi64(hi, 32)), epoch);
+        auto ts2 = _mm256_sub_epi64(ts_hi_mid, epoch);
+        auto ts6 = _mm256_sub_epi64(_mm256_or_si256(_mm256_slli_epi64(_mm256_srli_epi64(hi, 16), 12),
+                                                    _mm256_and_si256(hi, low12)),
+                                    epoch);
+
+        // ms fits in 48 bits; multiply low and high 32 bits separately.
+        auto ms = _mm256_srli_epi64(hi, 16);
+        auto ts7 = _mm256_add_epi64(
+                _mm256_mul_epu32(ms, ms_to_ticks),
+                _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(ms, 32), ms_to_ticks), 32));
+
+        auto ts = _mm256_setzero_si256();
+        ts = _mm256_blendv_epi8(ts, ts1, _mm256_cmpeq_epi64(ver, _mm256_set1_epi64x(version::v1)));
+        ts = _mm256_blendv_epi8(ts, ts2, _mm256_cmpeq_epi64(ver, _mm256_set1_epi64x(version::v2)));
+        ts = _mm256_blendv_epi8(ts, ts6, _mm256_cmpeq_epi64(ver, _mm256_set1_epi64x(version::v6)));
+        ts = _mm256_blendv_epi8(ts, ts7, _mm256_cmpeq_epi64(ver, _mm256_set1_epi64x(version::v7)));
+
+        alignas(32) int64_t ticks[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(ticks), ts);
+        for (int j = 0; j < 4; ++j) {
+            out[i + j] = uuid_timestamp(uuid_timestamp::duration(ticks[j]));
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+} // namespace
+
+void extract_timestamps(const uuid* ids, std::size_t count, uuid_timestamp* out) noexcept {
+    std::size_t done = 0;
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        done = extract_timestamps_avx2(ids, count, out);
+    }
+#endif
+
+    for (auto i = done; i < count; ++i) {
+        out[i] = ids[i].timestamp();
+    }
+}
+
+} // namespace uuidxx
@@ -0,0 +1,21 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_FIELDS_H_
+#define UUIDXX_UUID_FIELDS_H_
+
+#include <cstddef>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// Bulk version of `uuid::timestamp()`, ids of different versions can be mixed.
+// `out` must have room for `count` elements.
+// Decodes 4 ids at a time with AVX2 if available.
+void extract_timestamps(const uuid* ids, std::size_t count, uuid_timestamp* out) noexcept;
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_FIELDS_H_
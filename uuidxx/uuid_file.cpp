@@ -0,0 +1,245 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_file.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+namespace uuidxx {
+namespace {
+
+using details::uuid_file_header;
+
+// Compares a record with a key of native words; cheaper than encoding the key and calling
+// `memcmp()`, which can't be inlined for 16 bytes on all compilers.
+bool less(const uuid_record& rec, const uuid::data& key) noexcept {
+    const auto hi = rec.hi();
+    return hi < key[0] || (hi == key[0] && rec.lo() < key[1]);
+}
+
+} // namespace
+
+uuid_file_writer::~uuid_file_writer() {
+    abort();
+}
+
+bool uuid_file_writer::open(const std::string& path, std::size_t fence_stride) {
+    abort();
+
+    path_ = path;
+    file_ = std::fopen((path_ + ".tmp").c_str(), "wb");
+    if (file_ == nullptr) {
+        return false;
+    }
+
+    // Records stream through a large buffer; the header is written last.
+    std::setvbuf(file_, nullptr, _IOFBF, std::size_t{1} << 20);
+    const uuid_file_header placeholder{};
+    if (std::fwrite(&placeholder, sizeof(placeholder), 1, file_) != 1) {
+        abort();
+        return false;
+    }
+
+    fences_.clear();
+    fence_stride_ = fence_stride;
+    count_ = 0;
+    last_.reset();
+    return true;
+}
+
+bool uuid_file_writer::append(const uuid& id) {
+    if (file_ == nullptr || (last_ && !(*last_ < id))) {
+        return false;
+    }
+
+    if (fence_stride_ != 0 && count_ % fence_stride_ == 0) {
+        fences_.push_back(id.raw_data()[0]);
+    }
+
+    const auto rec = uuid_record::from_uuid(id);
+    if (std::fwrite(rec.bytes, sizeof(rec.bytes), 1, file_) != 1) {
+        return false;
+    }
+
+    last_ = id;
+    ++count_;
+    return true;
+}
+
+bool uuid_file_writer::finish() {
+    if (file_ == nullptr) {
+        return false;
+    }
+
+    uuid_file_header header{};
+    header.magic = uuid_file_header::k_magic;
+    header.version = uuid_file_header::k_version;
+    header.record_count = count_;
+    header.records_offset = sizeof(uuid_file_header);
+    if (!fences_.empty()) {
+        header.fence_offset = header.records_offset + count_ * sizeof(uuid_record);
+        header.fence_stride = fence_stride_;
+        header.fence_count = fences_.size();
+    }
+
+    const bool ok =
+            std::fwrite(fences_.data(), sizeof(uint64_t), fences_.size(), file_) ==
+                    fences_.size() &&
+            std::fseek(file_, 0, SEEK_SET) == 0 &&
+            std::fwrite(&header, sizeof(header), 1, file_) == 1 && std::fflush(file_) == 0;
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+
+    const auto tmp_path = path_ + ".tmp";
+    if (!ok || !closed) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    // Replaces a published file in place, so that it is left intact if this fails.
+#if defined(_WIN32)
+    const bool renamed =
+            MoveFileExA(tmp_path.c_str(), path_.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool renamed = std::rename(tmp_path.c_str(), path_.c_str()) == 0;
+#endif
+    if (!renamed) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void uuid_file_writer::abort() noexcept {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        file_ = nullptr;
+        std::remove((path_ + ".tmp").c_str());
+    }
+}
+
+bool write_uuid_file(const std::string& path, const uuid* ids, std::size_t count,
+                     std::size_t fence_stride) {
+    std::vector<uuid> sorted(ids, ids + count);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    uuid_file_writer writer;
+    if (!writer.open(path, fence_stride)) {
+        return false;
+    }
+
+    for (const auto& id : sorted) {
+        if (!writer.append(id)) {
+            return false;
+        }
+    }
+
+    return writer.finish();
+}
+
+bool uuid_file_reader::open(const std::string& path) {
+    close();
+
+    if (!file_.open_read_only(path) || file_.size() < sizeof(uuid_file_header)) {
+        file_.close();
+        return false;
+    }
+
+    uuid_file_header header;  // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::memcpy(&header, file_.data(), sizeof(header));
+
+    // Sizes are checked by division, as a malformed header may overflow products.
+    const auto size = static_cast<uint64_t>(file_.size());
+    const bool valid_records = header.magic == uuid_file_header::k_magic &&
+                               header.version == uuid_file_header::k_version &&
+                               header.records_offset >= sizeof(header) &&
+                               header.records_offset <= size &&
+                               header.record_count <=
+                                       (size - header.records_offset) / sizeof(uuid_record);
+    const bool valid_fences =
+            header.fence_count == 0 ||
+            (header.fence_stride != 0 && header.fence_offset % sizeof(uint64_t) == 0 &&
+             header.fence_offset <= size &&
+             header.fence_count <= (size - header.fence_offset) / sizeof(uint64_t) &&
+             header.fence_count == (header.record_count + header.fence_stride - 1) /
+                                           header.fence_stride);
+    if (!valid_records || !valid_fences) {
+        file_.close();
+        return false;
+    }
+
+    const auto* base = static_cast<const unsigned char*>(file_.data());
+    records_ = reinterpret_cast<const uuid_record*>(base + header.records_offset);
+    count_ = static_cast<std::size_t>(header.record_count);
+    if (header.fence_count != 0) {
+        fences_ = reinterpret_cast<const uint64_t*>(base + header.fence_offset);
+        fence_count_ = static_cast<std::size_t>(header.fence_count);
+        fence_stride_ = static_cast<std::size_t>(header.fence_stride);
+    }
+
+    return true;
+}
+
+void uuid_file_reader::close() noexcept {
+    file_.close();
+    records_ = nullptr;
+    count_ = 0;
+    fences_ = nullptr;
+    fence_count_ = 0;
+    fence_stride_ = 0;
+}
+
+std::size_t uuid_file_reader::lower_bound(const uuid& id) const noexcept {
+    const auto& key = id.raw_data();
+    std::size_t first = 0;
+    std::size_t last = count_;
+
+    // Fences below the key's high word start records below the key, and fences above it
+    // start records above it; thus the answer is within a stride or so.
+    if (fence_count_ != 0) {
+        const auto* fences_end = fences_ + fence_count_;
+        const auto lo_fence = std::lower_bound(fences_, fences_end, key[0]) - fences_;
+        const auto hi_fence = std::upper_bound(fences_ + lo_fence, fences_end, key[0]) - fences_;
+        if (lo_fence > 0) {
+            first = (static_cast<std::size_t>(lo_fence) - 1) * fence_stride_ + 1;
+        }
+        last = std::min(count_, static_cast<std::size_t>(hi_fence) * fence_stride_);
+    }
+
+    const auto* pos = std::lower_bound(records_ + first, records_ + last, key, less);
+    return static_cast<std::size_t>(pos - records_);
+}
+
+std::optional<std::size_t> uuid_file_reader::find(const uuid& id) const noexcept {
+    const auto pos = lower_bound(id);
+    if (pos == count_ || records_[pos] != id) {
+        return std::nullopt;
+    }
+
+    return pos;
+}
+
+bool uuid_file_reader::verify() const noexcept {
+    for (std::size_t i = 1; i < count_; ++i) {
+        if (!(records_[i - 1] < records_[i])) {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < fence_count_; ++i) {
+        if (fences_[i] != records_[i * fence_stride_].hi()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace uuidxx
@@ -0,0 +1,241 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_FILE_H_
+#define UUIDXX_UUID_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "uuidxx/endian_utils.h"
+#include "uuidxx/mapped_file.h"
+#include "uuidxx/uuid.h"
+
+// Binary uuid files hold a sorted set of distinct uuids:
+//
+//   header         64 bytes, see `details::uuid_file_header`
+//   records        16 bytes each, in network byte order, ascending
+//   fence index    optional; high word of every `fence_stride`-th record, as uint64_t
+//
+// Byte order of records is that of canonical strings, thus they compare by `memcmp()` and
+// are readable straight off a mapping, while header fields and fences are little-endian.
+
+namespace uuidxx {
+namespace details {
+
+struct uuid_file_header {
+    // "UUIDXXF1" on disk.
+    static constexpr uint64_t k_magic = UINT64_C(0x3146'5858'4449'5555);
+    static constexpr uint32_t k_version = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint64_t record_count;
+    uint64_t records_offset;
+    uint64_t fence_offset;
+    uint64_t fence_stride;
+    uint64_t fence_count;
+    uint64_t reserved;
+};
+
+static_assert(sizeof(uuid_file_header) == 64);
+
+} // namespace details
+
+// A record of a binary uuid file, i.e. a uuid in network byte order; converting it into a
+// `uuid` takes only two byte swaps.
+struct uuid_record {
+    unsigned char bytes[16];
+
+    [[nodiscard]] uint64_t hi() const noexcept {
+        uint64_t v;  // NOLINT(cppcoreguidelines-init-variables)
+        std::memcpy(&v, bytes, sizeof(v));
+        return byteswap(v);
+    }
+
+    [[nodiscard]] uint64_t lo() const noexcept {
+        uint64_t v;  // NOLINT(cppcoreguidelines-init-variables)
+        std::memcpy(&v, bytes + 8, sizeof(v));
+        return byteswap(v);
+    }
+
+    [[nodiscard]] uuid to_uuid() const noexcept {
+        return uuid(uuid::data{hi(), lo()}, details::gen_from_raw_data);
+    }
+
+    static uuid_record from_uuid(const uuid& id) noexcept {
+        const auto& raw = id.raw_data();
+        const uint64_t be[2]{byteswap(raw[0]), byteswap(raw[1])};
+        uuid_record rec;
+        std::memcpy(rec.bytes, be, sizeof(be));
+        return rec;
+    }
+};
+
+static_assert(sizeof(uuid_record) == 16 && alignof(uuid_record) == 1);
+
+inline bool operator==(const uuid_record& lhs, const uuid_record& rhs) noexcept {
+    return std::memcmp(lhs.bytes, rhs.bytes, sizeof(lhs.bytes)) == 0;
+}
+
+inline bool operator!=(const uuid_record& lhs, const uuid_record& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+// Same order as of `uuid`.
+inline bool operator<(const uuid_record& lhs, const uuid_record& rhs) noexcept {
+    return std::memcmp(lhs.bytes, rhs.bytes, sizeof(lhs.bytes)) < 0;
+}
+
+inline bool operator==(const uuid_record& lhs, const uuid& rhs) noexcept {
+    const auto& raw = rhs.raw_data();
+    return lhs.hi() == raw[0] && lhs.lo() == raw[1];
+}
+
+inline bool operator==(const uuid& lhs, const uuid_record& rhs) noexcept {
+    return rhs == lhs;
+}
+
+inline bool operator!=(const uuid_record& lhs, const uuid& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator!=(const uuid& lhs, const uuid_record& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+// Writes a binary uuid file from uuids appended in ascending order, streaming records to
+// disk; only fences are kept in memory.
+// Data goes into `path` + ".tmp", which is renamed to `path` by `finish()`; thus readers
+// never see a partial file, and those having mapped the old file keep reading it.
+class uuid_file_writer {
+public:
+    // Records per fence; small strides narrow searches down to fewer pages, at the cost of
+    // a larger fence index.
+    static constexpr std::size_t k_default_fence_stride = 1024;
+
+    uuid_file_writer() = default;
+
+    ~uuid_file_writer();
+
+    uuid_file_writer(const uuid_file_writer&) = delete;
+
+    uuid_file_writer(uuid_file_writer&&) = delete;
+
+    uuid_file_writer& operator=(const uuid_file_writer&) = delete;
+
+    uuid_file_writer& operator=(uuid_file_writer&&) = delete;
+
+    // `fence_stride` of 0 omits the fence index.
+    // Returns false on failure.
+    bool open(const std::string& path, std::size_t fence_stride = k_default_fence_stride);
+
+    // Returns false on write failure, or if `id` is not greater than the last one.
+    bool append(const uuid& id);
+
+    // Writes fences and the header, and moves the file into place.
+    // Returns false on failure; the file is then discarded.
+    bool finish();
+
+    // Discards the file, if not finished.
+    void abort() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return count_;
+    }
+
+private:
+    std::FILE* file_{nullptr};
+    std::string path_;
+    std::vector<uint64_t> fences_;
+    std::size_t fence_stride_{0};
+    std::size_t count_{0};
+    std::optional<uuid> last_;
+};
+
+// Sorts a copy of `ids`, removes duplicates, and writes them as a binary uuid file.
+bool write_uuid_file(const std::string& path, const uuid* ids, std::size_t count,
+                     std::size_t fence_stride = uuid_file_writer::k_default_fence_stride);
+
+// Maps a binary uuid file read-only, and searches and iterates records in place; opening
+// takes constant time regardless of the number of records.
+// Processes mapping the same file share one copy of it in the page cache.
+class uuid_file_reader {
+public:
+    using const_iterator = const uuid_record*;
+
+    uuid_file_reader() = default;
+
+    uuid_file_reader(const uuid_file_reader&) = delete;
+
+    uuid_file_reader(uuid_file_reader&&) = delete;
+
+    uuid_file_reader& operator=(const uuid_file_reader&) = delete;
+
+    uuid_file_reader& operator=(uuid_file_reader&&) = delete;
+
+    // Checks the header and sizes, but not the order of records, see `verify()`.
+    // Returns false if the file can't be mapped or is malformed, leaving it closed.
+    bool open(const std::string& path);
+
+    void close() noexcept;
+
+    [[nodiscard]] bool is_open() const noexcept {
+        return file_.is_open();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return count_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return count_ == 0;
+    }
+
+    [[nodiscard]] const uuid_record* data() const noexcept {
+        return records_;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return records_;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return records_ + count_;
+    }
+
+    const uuid_record& operator[](std::size_t pos) const noexcept {
+        return records_[pos];
+    }
+
+    // Position of the first record not less than `id`.
+    [[nodiscard]] std::size_t lower_bound(const uuid& id) const noexcept;
+
+    [[nodiscard]] std::optional<std::size_t> find(const uuid& id) const noexcept;
+
+    [[nodiscard]] bool contains(const uuid& id) const noexcept {
+        return find(id).has_value();
+    }
+
+    // Checks that records ascend, and fences match them; reads the whole file.
+    [[nodiscard]] bool verify() const noexcept;
+
+private:
+    details::mapped_file file_;
+    const uuid_record* records_{nullptr};
+    std::size_t count_{0};
+    const uint64_t* fences_{nullptr};
+    std::size_t fence_count_{0};
+    std::size_t fence_stride_{0};
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_FILE_H_
@@ -0,0 +1,174 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_filter.h"
+
+#include <algorithm>
+
+#include "uuidxx/cpu_features.h"
+#include "uuidxx/hash_mix.h"
+
+namespace uuidxx {
+namespace {
+
+// Odd constants for deriving 8 bit positions from one 32-bit hash, by multiply-shift.
+constexpr uint32_t k_salts[8]{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// Number of ids whose blocks are prefetched before probing in bulk operations.
+constexpr std::size_t k_batch_size = 16;
+
+void make_mask(uint32_t hash, uint32_t (&mask)[8]) noexcept {
+    for (int i = 0; i < 8; ++i) {
+        mask[i] = UINT32_C(1) << ((hash * k_salts[i]) >> 27);
+    }
+}
+
+void insert_scalar(uint32_t* words, uint32_t hash) noexcept {
+    uint32_t mask[8];
+    make_mask(hash, mask);
+    for (int i = 0; i < 8; ++i) {
+        words[i] |= mask[i];
+    }
+}
+
+bool check_scalar(const uint32_t* words, uint32_t hash) noexcept {
+    uint32_t mask[8];
+    make_mask(hash, mask);
+    uint32_t missed = 0;
+    for (int i = 0; i < 8; ++i) {
+        missed |= mask[i] & ~words[i];
+    }
+    return missed == 0;
+}
+
+#if UUIDXX_HAS_X86_SIMD
+
+UUIDXX_TARGET_AVX2 __m256i make_mask_avx2(uint32_t hash) noexcept {
+    const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(k_salts));
+    __m256i idx = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(hash)),
+                                                       salts),
+                                    27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), idx);
+}
+
+UUIDXX_TARGET_AVX2 void insert_avx2(uint32_t* words, uint32_t hash) noexcept {
+    auto* ptr = reinterpret_cast<__m256i*>(words);
+    _mm256_store_si256(ptr, _mm256_or_si256(_mm256_load_si256(ptr), make_mask_avx2(hash)));
+}
+
+UUIDXX_TARGET_AVX2 bool check_avx2(const uint32_t* words, uint32_t hash) noexcept {
+    auto block = _mm256_load_si256(reinterpret_cast<const __m256i*>(words));
+    return _mm256_testc_si256(block, make_mask_avx2(hash)) != 0;
+}
+
+#endif
+
+} // namespace
+
+uuid_filter::uuid_filter(std::size_t expected_count, std::size_t bits_per_id)
+    : blocks_(std::max<std::size_t>(1, (expected_count * bits_per_id + 255) / 256), block{}) {}
+
+uuid_filter::probe uuid_filter::make_probe(const uuid& id) const noexcept {
+    const auto& raw = id.raw_data();
+
+    uint32_t block_hash = 0;
+    uint32_t bits_hash = 0;
+    if (id.version() == version::v4) {
+        // Both are fully random in v4: time_low and low 32-bit of node.
+        block_hash = static_cast<uint32_t>(raw[0] >> 32);
+        bits_hash = static_cast<uint32_t>(raw[1]);
+    } else {
+        auto hash = details::mix128(raw[0], raw[1]);
+        block_hash = static_cast<uint32_t>(hash >> 32);
+        bits_hash = static_cast<uint32_t>(hash);
+    }
+
+    // Map into [0, blocks_.size()) without division.
+    auto block_idx = static_cast<std::size_t>(
+            (static_cast<uint64_t>(block_hash) * blocks_.size()) >> 32);
+
+    return {block_idx, bits_hash};
+}
+
+void uuid_filter::insert(const uuid& id) noexcept {
+    auto [idx, hash] = make_probe(id);
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        insert_avx2(blocks_[idx].words, hash);
+        return;
+    }
+#endif
+    insert_scalar(blocks_[idx].words, hash);
+}
+
+void uuid_filter::insert_many(const uuid* ids, std::size_t count) noexcept {
+    probe probes[k_batch_size];
+    for (std::size_t base = 0; base < count; base += k_batch_size) {
+        auto n = std::min(k_batch_size, count - base);
+        for (std::size_t i = 0; i < n; ++i) {
+            probes[i] = make_probe(ids[base + i]);
+            details::prefetch(&blocks_[probes[i].block_idx]);
+        }
+
+#if UUIDXX_HAS_X86_SIMD
+        if (details::cpu_has_avx2()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                insert_avx2(blocks_[probes[i].block_idx].words, probes[i].bits_hash);
+            }
+            continue;
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            insert_scalar(blocks_[probes[i].block_idx].words, probes[i].bits_hash);
+        }
+    }
+}
+
+bool uuid_filter::maybe_contains(const uuid& id) const noexcept {
+    auto [idx, hash] = make_probe(id);
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        return check_avx2(blocks_[idx].words, hash);
+    }
+#endif
+    return check_scalar(blocks_[idx].words, hash);
+}
+
+std::size_t uuid_filter::maybe_contains_many(const uuid* ids, std::size_t count,
+                                             bool* results) const noexcept {
+    std::size_t hits = 0;
+    probe probes[k_batch_size];
+    for (std::size_t base = 0; base < count; base += k_batch_size) {
+        auto n = std::min(k_batch_size, count - base);
+        for (std::size_t i = 0; i < n; ++i) {
+            probes[i] = make_probe(ids[base + i]);
+            details::prefetch(&blocks_[probes[i].block_idx]);
+        }
+
+#if UUIDXX_HAS_X86_SIMD
+        if (details::cpu_has_avx2()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                bool hit = check_avx2(blocks_[probes[i].block_idx].words, probes[i].bits_hash);
+                results[base + i] = hit;
+                hits += hit;
+            }
+            continue;
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            bool hit = check_scalar(blocks_[probes[i].block_idx].words, probes[i].bits_hash);
+            results[base + i] = hit;
+            hits += hit;
+        }
+    }
+
+    return hits;
+}
+
+void uuid_filter::clear() noexcept {
+    std::fill(blocks_.begin(), blocks_.end(), block{});
+}
+
+} // namespace uuidxx
@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_FILTER_H_
+#define UUIDXX_UUID_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// An approximate membership filter of uuids, i.e. a split block Bloom filter.
+// Each id touches only one 32-byte block, and sets one bit in each of the 8 words of the
+// block; probing a block takes a handful of AVX2 instructions if available.
+// Ids of v4 are already uniformly random, so their bits are used as hash values directly;
+// ids of other versions are mixed first.
+// Inserting is not thread-safe; probing concurrently is fine if no one inserts.
+class uuid_filter {
+public:
+    // About 0.5% false positive rate with the default `bits_per_id`.
+    explicit uuid_filter(std::size_t expected_count, std::size_t bits_per_id = 12);
+
+    void insert(const uuid& id) noexcept;
+
+    void insert_many(const uuid* ids, std::size_t count) noexcept;
+
+    // Returns false if `id` was definitely not inserted.
+    [[nodiscard]] bool maybe_contains(const uuid& id) const noexcept;
+
+    // Writes result of each id into `results`, which must have room for `count` elements.
+    // Returns number of ids that may be contained.
+    std::size_t maybe_contains_many(const uuid* ids, std::size_t count,
+                                    bool* results) const noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t memory_usage() const noexcept {
+        return blocks_.size() * sizeof(block);
+    }
+
+private:
+    struct alignas(32) block {
+        uint32_t words[8];
+    };
+
+    struct probe {
+        std::size_t block_idx;
+        uint32_t bits_hash;
+    };
+
+    probe make_probe(const uuid& id) const noexcept;
+
+private:
+    std::vector<block> blocks_;
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_FILTER_H_
@@ -0,0 +1,226 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_hll.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "uuidxx/bit_utils.h"
+#include "uuidxx/cpu_features.h"
+#include "uuidxx/hash_mix.h"
+
+namespace uuidxx {
+namespace {
+
+constexpr uint8_t k_format_version = 1;
+
+constexpr std::size_t k_header_size = 2;
+
+constexpr int k_register_bits = 6;
+
+// Number of ids whose registers are prefetched ahead in bulk additions.
+constexpr std::size_t k_prefetch_distance = 8;
+
+// sigma() and tau() of Ertl, "New cardinality estimation algorithms for HyperLogLog
+// sketches", 2017.
+
+double sigma(double x) noexcept {
+    if (x == 1.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    double y = 1.0;
+    double z = x;
+    for (double prev = -1.0; z != prev;) {
+        x *= x;
+        prev = z;
+        z += x * y;
+        y += y;
+    }
+    return z;
+}
+
+double tau(double x) noexcept {
+    if (x == 0.0 || x == 1.0) {
+        return 0.0;
+    }
+
+    double y = 1.0;
+    double z = 1.0 - x;
+    for (double prev = -1.0; z != prev;) {
+        x = std::sqrt(x);
+        prev = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    }
+    return z / 3.0;
+}
+
+#if UUIDXX_HAS_X86_SIMD
+
+// SSE2 is part of x86-64, thus needs no dispatch; counts are multiples of 16.
+void merge_sse2(uint8_t* dst, const uint8_t* src, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; i += 16) {
+        auto* d = reinterpret_cast<__m128i*>(dst + i);
+        const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(d, _mm_max_epu8(_mm_loadu_si128(d), s));
+    }
+}
+
+// Counts are multiples of 16; the last 16 bytes are left to SSE2.
+UUIDXX_TARGET_AVX2 void merge_avx2(uint8_t* dst, const uint8_t* src, std::size_t count) noexcept {
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        auto* d = reinterpret_cast<__m256i*>(dst + i);
+        const auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(d, _mm256_max_epu8(_mm256_loadu_si256(d), s));
+    }
+    merge_sse2(dst + i, src + i, count - i);
+}
+
+#else
+
+void merge_scalar(uint8_t* dst, const uint8_t* src, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = std::max(dst[i], src[i]);
+    }
+}
+
+#endif
+
+} // namespace
+
+uuid_hll::uuid_hll(int precision)
+    : precision_(std::clamp(precision, k_min_precision, k_max_precision)),
+      registers_(std::size_t{1} << precision_, 0) {}
+
+// static
+uint64_t uuid_hll::hash_of(const uuid& id) noexcept {
+    const auto& raw = id.raw_data();
+    if (id.version() == version::v4) {
+        // Random in v4: time_low and time_mid, i.e. high 48 bits, and low 16 bits of node.
+        return (raw[0] & ~UINT64_C(0xffff)) | (raw[1] & UINT64_C(0xffff));
+    }
+
+    return details::mix128(raw[0], raw[1]);
+}
+
+uint8_t uuid_hll::rank(uint64_t hash) const noexcept {
+    // The sentinel bit caps the rank when all remaining bits are zeros.
+    const auto rest = (hash << precision_) | (UINT64_C(1) << (precision_ - 1));
+    return static_cast<uint8_t>(details::count_leading_zeros(rest) + 1);
+}
+
+void uuid_hll::add_many(const uuid* ids, std::size_t count) noexcept {
+    // Registers of large sketches don't fit in L1; hashes of ids ahead are prefetched.
+    uint64_t hashes[k_prefetch_distance];
+    const auto shift = 64 - precision_;
+    for (std::size_t i = 0; i < count; i += k_prefetch_distance) {
+        const auto n = std::min(count - i, k_prefetch_distance);
+        for (std::size_t j = 0; j < n; ++j) {
+            hashes[j] = hash_of(ids[i + j]);
+            details::prefetch(&registers_[static_cast<std::size_t>(hashes[j] >> shift)]);
+        }
+
+        for (std::size_t j = 0; j < n; ++j) {
+            auto& reg = registers_[static_cast<std::size_t>(hashes[j] >> shift)];
+            reg = std::max(reg, rank(hashes[j]));
+        }
+    }
+}
+
+bool uuid_hll::merge(const uuid_hll& other) noexcept {
+    if (other.precision_ != precision_) {
+        return false;
+    }
+
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        merge_avx2(registers_.data(), other.registers_.data(), registers_.size());
+    } else {
+        merge_sse2(registers_.data(), other.registers_.data(), registers_.size());
+    }
+#else
+    merge_scalar(registers_.data(), other.registers_.data(), registers_.size());
+#endif
+    return true;
+}
+
+double uuid_hll::estimate() const noexcept {
+    const int q = 64 - precision_;
+
+    // Histogram of register values, which are in [0, q + 1].
+    uint32_t counts[66]{};
+    for (auto reg : registers_) {
+        ++counts[reg];
+    }
+
+    const auto m = static_cast<double>(registers_.size());
+    double z = m * tau(1.0 - counts[q + 1] / m);
+    for (int k = q; k >= 1; --k) {
+        z = 0.5 * (z + counts[k]);
+    }
+    z += m * sigma(counts[0] / m);
+
+    // alpha_inf = 1 / (2 * ln 2).
+    constexpr double alpha_inf = 0.721347520444481703680;
+    return alpha_inf * m * m / z;
+}
+
+void uuid_hll::clear() noexcept {
+    std::fill(registers_.begin(), registers_.end(), uint8_t{0});
+}
+
+std::vector<uint8_t> uuid_hll::serialize() const {
+    std::vector<uint8_t> out(k_header_size + registers_.size() * k_register_bits / 8, 0);
+    out[0] = k_format_version;
+    out[1] = static_cast<uint8_t>(precision_);
+
+    // Every 4 registers pack into 3 bytes, from the most significant bit.
+    auto* dst = out.data() + k_header_size;
+    for (std::size_t i = 0; i < registers_.size(); i += 4, dst += 3) {
+        const uint32_t packed = (static_cast<uint32_t>(registers_[i]) << 18) |
+                                (static_cast<uint32_t>(registers_[i + 1]) << 12) |
+                                (static_cast<uint32_t>(registers_[i + 2]) << 6) |
+                                registers_[i + 3];
+        dst[0] = static_cast<uint8_t>(packed >> 16);
+        dst[1] = static_cast<uint8_t>(packed >> 8);
+        dst[2] = static_cast<uint8_t>(packed);
+    }
+    return out;
+}
+
+// static
+std::optional<uuid_hll> uuid_hll::deserialize(const uint8_t* data, std::size_t size) {
+    if (size < k_header_size || data[0] != k_format_version || data[1] < k_min_precision ||
+        data[1] > k_max_precision) {
+        return std::nullopt;
+    }
+
+    uuid_hll hll(data[1]);
+    const auto& regs = hll.registers_;
+    if (size != k_header_size + regs.size() * k_register_bits / 8) {
+        return std::nullopt;
+    }
+
+    const auto max_rank = static_cast<uint8_t>(65 - hll.precision_);
+    const auto* src = data + k_header_size;
+    for (std::size_t i = 0; i < regs.size(); i += 4, src += 3) {
+        const uint32_t packed = (static_cast<uint32_t>(src[0]) << 16) |
+                                (static_cast<uint32_t>(src[1]) << 8) | src[2];
+        for (std::size_t j = 0; j < 4; ++j) {
+            const auto reg = static_cast<uint8_t>((packed >> (18 - j * 6)) & 0x3f);
+            if (reg > max_rank) {
+                return std::nullopt;
+            }
+            hll.registers_[i + j] = reg;
+        }
+    }
+
+    return hll;
+}
+
+} // namespace uuidxx
@@ -0,0 +1,80 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_HLL_H_
+#define UUIDXX_UUID_HLL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// A HyperLogLog sketch estimating the number of distinct uuids, in 2^precision bytes,
+// with a relative standard error of about 1.04 / sqrt(2^precision), e.g. 0.81% with the
+// default precision of 14 in 16 KiB.
+// Ids of v4 are already uniformly random, so their random bits are used as hash values
+// directly; ids of other versions are mixed first.
+// The estimate is the improved estimator of Ertl, which is unbiased over the whole range
+// without empirical correction tables.
+// Sketches of the same precision merge into the sketch of the union, thus they can be
+// filled per thread or per node, and combined later.
+// This class is not thread-safe.
+class uuid_hll {
+public:
+    static constexpr int k_min_precision = 4;
+    static constexpr int k_max_precision = 18;
+    static constexpr int k_default_precision = 14;
+
+    // `precision` is clamped into [k_min_precision, k_max_precision].
+    explicit uuid_hll(int precision = k_default_precision);
+
+    [[nodiscard]] int precision() const noexcept {
+        return precision_;
+    }
+
+    void add(const uuid& id) noexcept {
+        const auto hash = hash_of(id);
+        auto& reg = registers_[static_cast<std::size_t>(hash >> (64 - precision_))];
+        const auto r = rank(hash);
+        reg = r > reg ? r : reg;
+    }
+
+    void add_many(const uuid* ids, std::size_t count) noexcept;
+
+    // Returns false, leaving this sketch untouched, if precisions differ.
+    bool merge(const uuid_hll& other) noexcept;
+
+    [[nodiscard]] double estimate() const noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t memory_usage() const noexcept {
+        return registers_.size();
+    }
+
+    // A version byte, the precision byte, and then 6 bits per register, i.e. 3/4 of the
+    // in-memory size.
+    [[nodiscard]] std::vector<uint8_t> serialize() const;
+
+    // Returns std::nullopt if `data` is not produced by `serialize()`.
+    static std::optional<uuid_hll> deserialize(const uint8_t* data, std::size_t size);
+
+private:
+    static uint64_t hash_of(const uuid& id) noexcept;
+
+    // Position of the first 1-bit after the index bits, from 1; at most 65 - precision.
+    uint8_t rank(uint64_t hash) const noexcept;
+
+private:
+    int precision_;
+    std::vector<uint8_t> registers_;
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_HLL_H_
@@ -0,0 +1,237 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_interner.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "uuidxx/bit_utils.h"
+#include "uuidxx/cpu_features.h"
+
+namespace uuidxx {
+namespace {
+
+// Number of ids grouped by shard at a time in bulk operations.
+constexpr std::size_t k_batch_size = 256;
+
+// Number of slots probed ahead in bulk operations.
+constexpr std::size_t k_prefetch_distance = 4;
+
+constexpr std::size_t k_initial_slots = 16;
+
+} // namespace
+
+template<typename KeyType>
+basic_uuid_interner<KeyType>::basic_uuid_interner() {
+    for (auto& s : shards_) {
+        s.slots.assign(k_initial_slots, slot{0, k_invalid_key});
+    }
+}
+
+template<typename KeyType>
+basic_uuid_interner<KeyType>::~basic_uuid_interner() {
+    for (auto& chunk : chunks_) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+template<typename KeyType>
+KeyType basic_uuid_interner<KeyType>::intern(const uuid& id) {
+    const auto hash = hash_of(id);
+    auto& s = shards_[shard_index(hash)];
+    const std::lock_guard lock(s.mtx);
+    return intern_locked(s, id, hash);
+}
+
+template<typename KeyType>
+void basic_uuid_interner<KeyType>::intern_many(const uuid* ids, std::size_t count,
+                                               KeyType* keys) {
+    uint64_t hashes[k_batch_size];
+    uint16_t order[k_batch_size];
+    std::size_t offsets[k_shard_count + 1];
+
+    for (std::size_t base = 0; base < count; base += k_batch_size) {
+        const auto n = std::min(k_batch_size, count - base);
+
+        // Counting sort of ids in the batch by shard.
+        std::fill(std::begin(offsets), std::end(offsets), 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            hashes[i] = hash_of(ids[base + i]);
+            ++offsets[shard_index(hashes[i]) + 1];
+        }
+
+        for (std::size_t i = 0; i < k_shard_count; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            order[offsets[shard_index(hashes[i])]++] = static_cast<uint16_t>(i);
+        }
+
+        // Now offsets[i] is the end of shard i.
+        std::size_t first = 0;
+        for (std::size_t sidx = 0; sidx < k_shard_count; ++sidx) {
+            const auto last = offsets[sidx];
+            if (first == last) {
+                continue;
+            }
+
+            auto& s = shards_[sidx];
+            const std::lock_guard lock(s.mtx);
+            for (auto i = first; i < last; ++i) {
+                if (i + k_prefetch_distance < last) {
+                    auto ahead = hashes[order[i + k_prefetch_distance]];
+                    details::prefetch(&s.slots[ahead & (s.slots.size() - 1)]);
+                }
+
+                const auto j = order[i];
+                keys[base + j] = intern_locked(s, ids[base + j], hashes[j]);
+            }
+
+            first = last;
+        }
+    }
+}
+
+template<typename KeyType>
+std::optional<KeyType> basic_uuid_interner<KeyType>::find(const uuid& id) const {
+    const auto hash = hash_of(id);
+    const auto& s = shards_[shard_index(hash)];
+    const std::lock_guard lock(s.mtx);
+    return find_locked(s, id, hash);
+}
+
+template<typename KeyType>
+uuid basic_uuid_interner<KeyType>::lookup(KeyType key) const noexcept {
+    return uuid(stored(key), details::gen_from_raw_data);
+}
+
+template<typename KeyType>
+void basic_uuid_interner<KeyType>::lookup_many(const KeyType* keys, std::size_t count,
+                                               uuid* ids) const noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        ids[i] = uuid(stored(keys[i]), details::gen_from_raw_data);
+    }
+}
+
+template<typename KeyType>
+std::size_t basic_uuid_interner<KeyType>::size() const noexcept {
+    // The counter goes beyond `k_invalid_key` once keys are exhausted.
+    const auto next = next_key_.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(std::min<uint64_t>(next, k_invalid_key));
+}
+
+template<typename KeyType>
+std::size_t basic_uuid_interner<KeyType>::memory_usage() const {
+    std::size_t usage = 0;
+    for (const auto& s : shards_) {
+        const std::lock_guard lock(s.mtx);
+        usage += s.slots.capacity() * sizeof(slot);
+    }
+
+    for (int i = 0; i < k_max_chunks; ++i) {
+        if (chunks_[i].load(std::memory_order_relaxed)) {
+            usage += (k_first_chunk_size << i) * sizeof(uuid::data);
+        }
+    }
+
+    return usage;
+}
+
+template<typename KeyType>
+KeyType basic_uuid_interner<KeyType>::intern_locked(shard& s, const uuid& id, uint64_t hash) {
+    if (auto key = find_locked(s, id, hash)) {
+        return *key;
+    }
+
+    const auto next = next_key_.fetch_add(1, std::memory_order_relaxed);
+    if (next >= k_invalid_key) {
+        return k_invalid_key;
+    }
+
+    // Published to other threads by unlocking the shard, or by whatever passes the key.
+    store(next, id.raw_data());
+
+    if ((s.count + 1) * 2 > s.slots.size()) {
+        grow(s);
+    }
+
+    const auto mask = s.slots.size() - 1;
+    for (auto idx = hash & mask;; idx = (idx + 1) & mask) {
+        if (s.slots[idx].key == k_invalid_key) {
+            s.slots[idx] = slot{hash, static_cast<KeyType>(next)};
+            ++s.count;
+            return static_cast<KeyType>(next);
+        }
+    }
+}
+
+template<typename KeyType>
+std::optional<KeyType> basic_uuid_interner<KeyType>::find_locked(const shard& s, const uuid& id,
+                                                                 uint64_t hash) const {
+    const auto mask = s.slots.size() - 1;
+    for (auto idx = hash & mask;; idx = (idx + 1) & mask) {
+        const auto& sl = s.slots[idx];
+        if (sl.key == k_invalid_key) {
+            return std::nullopt;
+        }
+
+        if (sl.hash == hash && stored(sl.key) == id.raw_data()) {
+            return sl.key;
+        }
+    }
+}
+
+template<typename KeyType>
+void basic_uuid_interner<KeyType>::grow(shard& s) {
+    std::vector<slot> slots(s.slots.size() * 2, slot{0, k_invalid_key});
+    const auto mask = slots.size() - 1;
+    for (const auto& sl : s.slots) {
+        if (sl.key == k_invalid_key) {
+            continue;
+        }
+
+        auto idx = sl.hash & mask;
+        while (slots[idx].key != k_invalid_key) {
+            idx = (idx + 1) & mask;
+        }
+        slots[idx] = sl;
+    }
+
+    s.slots.swap(slots);
+}
+
+template<typename KeyType>
+const uuid::data& basic_uuid_interner<KeyType>::stored(KeyType key) const noexcept {
+    const uint64_t pos = static_cast<uint64_t>(key) + k_first_chunk_size;
+    const int bits = details::floor_log2(pos);
+    const auto chunk = chunks_[bits - k_first_chunk_bits].load(std::memory_order_acquire);
+    return chunk[pos - (UINT64_C(1) << bits)];
+}
+
+template<typename KeyType>
+void basic_uuid_interner<KeyType>::store(uint64_t key, const uuid::data& raw) {
+    const uint64_t pos = key + k_first_chunk_size;
+    const int bits = details::floor_log2(pos);
+    auto& chunk = chunks_[bits - k_first_chunk_bits];
+
+    auto ptr = chunk.load(std::memory_order_acquire);
+    if (!ptr) {
+        // Shards may race to allocate the same chunk, and only one wins.
+        auto fresh = new uuid::data[k_first_chunk_size << (bits - k_first_chunk_bits)];
+        if (chunk.compare_exchange_strong(ptr, fresh, std::memory_order_acq_rel)) {
+            ptr = fresh;
+        } else {
+            delete[] fresh;
+        }
+    }
+
+    ptr[pos - (UINT64_C(1) << bits)] = raw;
+}
+
+template class basic_uuid_interner<uint32_t>;
+template class basic_uuid_interner<uint64_t>;
+
+} // namespace uuidxx
@@ -0,0 +1,127 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_INTERNER_H_
+#define UUIDXX_UUID_INTERNER_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "uuidxx/cache_line.h"
+#include "uuidxx/hash_mix.h"
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// Maps uuids to dense integer keys, which are assigned from 0 in order of first sight,
+// and maps keys back to uuids.
+// Keys are indexed by open addressing tables of shards, each guarded by its own lock.
+// Uuids are stored by key in an append-only array, which grows by chunks without moving
+// elements; thus mapping keys back takes no lock.
+// This class is thread-safe; only `uint32_t` and `uint64_t` keys are supported.
+template<typename KeyType>
+class basic_uuid_interner {
+public:
+    static_assert(std::is_same_v<KeyType, uint32_t> || std::is_same_v<KeyType, uint64_t>);
+
+    using key_type = KeyType;
+
+    // Returned once keys are exhausted; it is never assigned.
+    static constexpr KeyType k_invalid_key = std::numeric_limits<KeyType>::max();
+
+    basic_uuid_interner();
+
+    ~basic_uuid_interner();
+
+    basic_uuid_interner(const basic_uuid_interner&) = delete;
+
+    basic_uuid_interner(basic_uuid_interner&&) = delete;
+
+    basic_uuid_interner& operator=(const basic_uuid_interner&) = delete;
+
+    basic_uuid_interner& operator=(basic_uuid_interner&&) = delete;
+
+    // Returns the key of `id`, assigning a new one on first sight.
+    KeyType intern(const uuid& id);
+
+    // Writes key of each id into `keys`, which must have room for `count` elements.
+    // Ids are grouped by shard in batches, so that each shard is locked once per batch.
+    void intern_many(const uuid* ids, std::size_t count, KeyType* keys);
+
+    [[nodiscard]] std::optional<KeyType> find(const uuid& id) const;
+
+    // `key` must have been returned by `intern()` or `intern_many()`.
+    [[nodiscard]] uuid lookup(KeyType key) const noexcept;
+
+    // `ids` must have room for `count` elements.
+    void lookup_many(const KeyType* keys, std::size_t count, uuid* ids) const noexcept;
+
+    // Number of keys assigned.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    [[nodiscard]] std::size_t memory_usage() const;
+
+private:
+    struct slot {
+        uint64_t hash;
+        KeyType key;
+    };
+
+    struct alignas(details::k_cache_line_size) shard {
+        mutable std::mutex mtx;
+        std::vector<slot> slots;
+        std::size_t count{0};
+    };
+
+    static constexpr int k_shard_bits = 6;
+    static constexpr std::size_t k_shard_count = std::size_t{1} << k_shard_bits;
+
+    // Chunk i holds `k_first_chunk_size << i` elements.
+    static constexpr int k_first_chunk_bits = 12;
+    static constexpr std::size_t k_first_chunk_size = std::size_t{1} << k_first_chunk_bits;
+    static constexpr int k_max_chunks = 64 - k_first_chunk_bits;
+
+    // Same as `std::hash<uuid>` on 64-bit platforms.
+    static uint64_t hash_of(const uuid& id) noexcept {
+        const auto& raw = id.raw_data();
+        return details::mix128(raw[0], raw[1]);
+    }
+
+    // Top bits pick the shard, and low bits pick the slot.
+    static std::size_t shard_index(uint64_t hash) noexcept {
+        return static_cast<std::size_t>(hash >> (64 - k_shard_bits));
+    }
+
+    // Requires the lock of `s`.
+    KeyType intern_locked(shard& s, const uuid& id, uint64_t hash);
+
+    // Requires the lock of `s`.
+    std::optional<KeyType> find_locked(const shard& s, const uuid& id, uint64_t hash) const;
+
+    // Requires the lock of `s`.
+    void grow(shard& s);
+
+    const uuid::data& stored(KeyType key) const noexcept;
+
+    void store(uint64_t key, const uuid::data& raw);
+
+private:
+    std::array<shard, k_shard_count> shards_;
+    std::atomic<uuid::data*> chunks_[k_max_chunks]{};
+    std::atomic<uint64_t> next_key_{0};
+};
+
+using uuid_interner = basic_uuid_interner<uint32_t>;
+using uuid_interner64 = basic_uuid_interner<uint64_t>;
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_INTERNER_H_
@@ -0,0 +1,243 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_PARTITION_H_
+#define UUIDXX_UUID_PARTITION_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "uuidxx/cache_line.h"
+#include "uuidxx/cpu_features.h"
+#include "uuidxx/hash_mix.h"
+#include "uuidxx/parallel_for.h"
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// Shard functions map a uuid to [0, shards), and must be pure; `partition()` calls them
+// twice per id.
+
+// Scales the leading 32 bits to [0, shards) with a multiply instead of a division.
+// Only suited to ids whose leading bits are random, e.g. v4; those of v1 cycle within
+// minutes, and those of v7 are timestamps.
+struct high_bits_shard {
+    uint32_t operator()(const uuid& id, uint32_t shards) const noexcept {
+        const auto top = id.raw_data()[0] >> 32;
+        return static_cast<uint32_t>((top * shards) >> 32);
+    }
+};
+
+namespace details {
+
+// Lamping and Veach, "A Fast, Minimal Memory, Consistent Hash Algorithm".
+inline uint32_t jump_consistent_hash(uint64_t key, uint32_t buckets) noexcept {
+    int64_t b = -1;
+    int64_t j = 0;
+    while (j < static_cast<int64_t>(buckets)) {
+        b = j;
+        key = key * UINT64_C(2862933555777941757) + 1;
+        j = static_cast<int64_t>(static_cast<double>(b + 1) *
+                                 (static_cast<double>(INT64_C(1) << 31) /
+                                  static_cast<double>((key >> 33) + 1)));
+    }
+    return static_cast<uint32_t>(b);
+}
+
+} // namespace details
+
+// Works for uuids of any version. Growing from n to n + 1 shards moves only the ids that
+// land in the new shard, i.e. about 1 / (n + 1) of them.
+// It takes a chain of about ln(shards) divisions, thus partitioning with it is bound by
+// computation rather than memory; prefer `high_bits_shard` for random ids.
+struct jump_consistent_shard {
+    uint32_t operator()(const uuid& id, uint32_t shards) const noexcept {
+        const auto& raw = id.raw_data();
+        return details::jump_consistent_hash(details::mix128(raw[0], raw[1]), shards);
+    }
+};
+
+struct partition_options {
+    // Number of threads, including the calling one; 0 means number of cores.
+    std::size_t threads{0};
+
+    // Fewer threads are used if each would get fewer ids than this, as threads are started
+    // twice, once per pass.
+    std::size_t min_ids_per_thread{1 << 18};
+};
+
+namespace details {
+
+static_assert(std::is_trivially_copyable_v<uuid>);
+
+inline constexpr std::size_t k_ids_per_wc_line = k_cache_line_size / sizeof(uuid);
+
+// Up to this many shards, ids are stored to `out` directly.
+inline constexpr uint32_t k_direct_scatter_shards = 32;
+
+// Outputs smaller than this likely stay in cache, and bypassing the cache would only
+// make readers miss.
+inline constexpr std::size_t k_streaming_threshold = 4 << 20;
+
+// Software write-combining buffer of one shard, which mirrors the cache line of `out`
+// being filled.
+struct alignas(k_cache_line_size) wc_line {
+    uuid::data slots[k_ids_per_wc_line];
+};
+
+inline void stream_line(const wc_line& line, uuid* dst) noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    auto* to = reinterpret_cast<__m128i*>(dst);
+    const auto* from = reinterpret_cast<const __m128i*>(line.slots);
+    for (std::size_t i = 0; i < k_ids_per_wc_line; ++i) {
+        _mm_stream_si128(to + i, _mm_load_si128(from + i));
+    }
+#else
+    std::memcpy(static_cast<void*>(dst), line.slots, sizeof(line.slots));
+#endif
+}
+
+inline void stream_fence() noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    _mm_sfence();
+#endif
+}
+
+// Writes positions [first, last) of `out`, which lie in one cache line; `skew` is the slot
+// of position 0.
+inline void flush_line(const wc_line& line, uuid* out, std::size_t first, std::size_t last,
+                       std::size_t skew, bool streaming) noexcept {
+    if (streaming && last - first == k_ids_per_wc_line) {
+        stream_line(line, out + first);
+        return;
+    }
+
+    for (auto pos = first; pos < last; ++pos) {
+        std::memcpy(static_cast<void*>(out + pos),
+                    &line.slots[(skew + pos) % k_ids_per_wc_line], sizeof(uuid));
+    }
+}
+
+template<typename ShardFn>
+void count_shards(const uuid* ids, std::size_t first, std::size_t last, uint32_t shards,
+                  std::size_t* counts, const ShardFn& shard_of) {
+    std::vector<std::size_t> local(shards, 0);
+    for (auto i = first; i < last; ++i) {
+        ++local[shard_of(ids[i], shards)];
+    }
+    std::copy(local.begin(), local.end(), counts);
+}
+
+// `cursors[s]` is where ids of shard `s` in [first, last) start in `out`.
+template<typename ShardFn>
+void scatter_shards(const uuid* ids, std::size_t first, std::size_t last, uint32_t shards,
+                    const std::size_t* cursors, uuid* out, bool streaming,
+                    const ShardFn& shard_of) {
+    std::vector<std::size_t> ends(cursors, cursors + shards);
+
+    // Stores of a few streams are combined in L1 anyway, and buffering only adds copies.
+    if (shards <= k_direct_scatter_shards) {
+        for (auto i = first; i < last; ++i) {
+            out[ends[shard_of(ids[i], shards)]++] = ids[i];
+        }
+        return;
+    }
+
+    const std::vector<std::size_t> begins(ends);
+    std::vector<wc_line> lines(shards);
+
+    // Lines are whole only if `out` is aligned to `sizeof(uuid)`; streaming stores
+    // require it anyway.
+    const std::size_t skew =
+            reinterpret_cast<std::uintptr_t>(out) % k_cache_line_size / sizeof(uuid);
+
+    for (auto i = first; i < last; ++i) {
+        const auto s = shard_of(ids[i], shards);
+        const auto pos = ends[s]++;
+        const auto slot = (skew + pos) % k_ids_per_wc_line;
+
+        // Copies as a whole, so that `stream_line()` loads are forwarded from this store.
+        std::memcpy(&lines[s].slots[slot], &ids[i], sizeof(uuid));
+        if (slot == k_ids_per_wc_line - 1) {
+            // The first line of a shard may start before its range, which belongs to others.
+            const auto line_end = pos + 1;
+            const auto line_first =
+                    line_end - std::min(line_end - begins[s], k_ids_per_wc_line);
+            flush_line(lines[s], out, line_first, line_end, skew, streaming);
+        }
+    }
+
+    for (uint32_t s = 0; s < shards; ++s) {
+        const auto pending =
+                std::min((skew + ends[s]) % k_ids_per_wc_line, ends[s] - begins[s]);
+        flush_line(lines[s], out, ends[s] - pending, ends[s], skew, false);
+    }
+
+    if (streaming) {
+        stream_fence();
+    }
+}
+
+} // namespace details
+
+// Reorders `count` ids into `out` grouped by shard, i.e. a radix partition on
+// `shard_of(id, shards)`, and returns `shards + 1` bounds: ids of shard `s` are in
+// [bounds[s], bounds[s + 1]) of `out`, in their input order.
+// The first pass counts ids per shard, and the second scatters them; beyond a few dozen
+// shards, through a one-line buffer per shard, so that `out` is written a cache line at a
+// time, bypassing the cache for large outputs. Meant for up to a few thousand shards,
+// whose buffers fit in L2.
+// `out` must have room for `count` uuids, and not overlap `ids`.
+// Returns an empty vector and writes nothing if `shards` is 0.
+template<typename ShardFn = jump_consistent_shard>
+std::vector<std::size_t> partition(const uuid* ids, std::size_t count, uint32_t shards,
+                                   uuid* out, ShardFn shard_of = {},
+                                   const partition_options& opts = {}) {
+    if (shards == 0) {
+        return {};
+    }
+
+    // Threads take consecutive chunks, thus the partition stays stable.
+    const auto workers = details::worker_count(count, opts.threads, opts.min_ids_per_thread);
+    const auto chunk = (count + workers - 1) / workers;
+    auto chunk_first = [count, chunk](std::size_t worker) {
+        return std::min(count, worker * chunk);
+    };
+
+    // Per-worker counts at first, then per-worker starting positions.
+    std::vector<std::size_t> cursors(workers * shards);
+    details::parallel_for(workers, [&](std::size_t w) {
+        details::count_shards(ids, chunk_first(w), chunk_first(w + 1), shards,
+                              cursors.data() + w * shards, shard_of);
+    });
+
+    std::vector<std::size_t> bounds(shards + 1);
+    std::size_t offset = 0;
+    for (uint32_t s = 0; s < shards; ++s) {
+        bounds[s] = offset;
+        for (std::size_t w = 0; w < workers; ++w) {
+            auto& cursor = cursors[w * shards + s];
+            offset += std::exchange(cursor, offset);
+        }
+    }
+    bounds[shards] = offset;
+
+    const bool streaming = count * sizeof(uuid) >= details::k_streaming_threshold &&
+                           reinterpret_cast<std::uintptr_t>(out) % sizeof(uuid) == 0;
+    details::parallel_for(workers, [&](std::size_t w) {
+        details::scatter_shards(ids, chunk_first(w), chunk_first(w + 1), shards,
+                                cursors.data() + w * shards, out, streaming, shard_of);
+    });
+
+    return bounds;
+}
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_PARTITION_H_
@@ -0,0 +1,176 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_pool.h"
+
+#include <algorithm>
+
+namespace uuidxx {
+namespace {
+
+std::size_t round_up_pow2(std::size_t n) {
+    std::size_t cap = 2;
+    while (cap < n) {
+        cap <<= 1;
+    }
+    return cap;
+}
+
+} // namespace
+
+uuid_pool::uuid_pool(uuid_pool_options opts)
+    : mask_(round_up_pow2(opts.capacity) - 1),
+      low_watermark_(std::min(opts.low_watermark, mask_)),
+      high_watermark_(opts.high_watermark == 0 ? mask_ + 1
+                                               : std::min(opts.high_watermark, mask_ + 1)),
+      fallback_inline_(opts.fallback_inline),
+      generator_(std::move(opts.generator)),
+      slots_(new slot[mask_ + 1]) {
+    if (!generator_) {
+        generator_ = [] { return make_v4(); };
+    }
+
+    high_watermark_ = std::max(high_watermark_, low_watermark_ + 1);
+
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // Pay the cost of the first generation, e.g. seeding, right here instead of on a
+    // request thread.
+    fill();
+
+    refiller_ = std::thread(&uuid_pool::run_refill, this);
+}
+
+uuid_pool::~uuid_pool() {
+    {
+        const std::lock_guard lock(mtx_);
+        stopped_ = true;
+    }
+
+    cv_.notify_one();
+    refiller_.join();
+}
+
+uuid uuid_pool::take() {
+    for (;;) {
+        if (auto id = try_take(); id) {
+            return *id;
+        }
+
+        if (fallback_inline_) {
+            fallbacks_.fetch_add(1, std::memory_order_relaxed);
+            return generator_();
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+std::optional<uuid> uuid_pool::try_take() {
+    auto pos = head_.load(std::memory_order_relaxed);
+    slot* cell = nullptr;
+    for (;;) {
+        cell = &slots_[pos & mask_];
+        auto seq = cell->seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            notify_if_low();
+            return std::nullopt;
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+
+    uuid id = cell->value;
+    cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+
+    notify_if_low();
+
+    return id;
+}
+
+std::size_t uuid_pool::available() const noexcept {
+    auto head = head_.load(std::memory_order_relaxed);
+    auto tail = tail_.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+bool uuid_pool::try_push(const uuid& id) {
+    auto pos = tail_.load(std::memory_order_relaxed);
+    slot* cell = nullptr;
+    for (;;) {
+        cell = &slots_[pos & mask_];
+        auto seq = cell->seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->value = id;
+    cell->seq.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+void uuid_pool::fill() {
+    while (available() < high_watermark_) {
+        if (!try_push(generator_())) {
+            break;
+        }
+    }
+}
+
+void uuid_pool::notify_if_low() {
+    if (available() > low_watermark_) {
+        return;
+    }
+
+    // Only the first thread observing the low mark takes the lock.
+    if (refill_pending_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    {
+        const std::lock_guard lock(mtx_);
+        refill_requested_ = true;
+    }
+
+    cv_.notify_one();
+}
+
+void uuid_pool::run_refill() {
+    for (;;) {
+        {
+            std::unique_lock lock(mtx_);
+            cv_.wait(lock, [this] { return stopped_ || refill_requested_; });
+            if (stopped_) {
+                return;
+            }
+            refill_requested_ = false;
+        }
+
+        do {
+            refill_pending_.store(false, std::memory_order_release);
+            fill();
+            refills_.fetch_add(1, std::memory_order_relaxed);
+            // Consumers may have drained the pool while we were filling and seen the
+            // pending flag still set.
+        } while (available() <= low_watermark_);
+    }
+}
+
+} // namespace uuidxx
@@ -0,0 +1,125 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_POOL_H_
+#define UUIDXX_UUID_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "uuidxx/cache_line.h"
+#include "uuidxx/uuidxx.h"
+
+namespace uuidxx {
+
+struct uuid_pool_options {
+    // Number of slots in the ring buffer; rounded up to a power of 2.
+    std::size_t capacity{4096};
+
+    // The background thread is woken up once available ids drop to or below this mark.
+    std::size_t low_watermark{1024};
+
+    // A refill stops once available ids reach this mark; 0 means `capacity`.
+    std::size_t high_watermark{0};
+
+    // If true, `take()` generates an id inline on an empty pool; otherwise, it waits
+    // until the background thread catches up.
+    bool fallback_inline{true};
+
+    // Must be thread-safe if `fallback_inline` is true, because it then may be called by
+    // request threads and the background thread concurrently.
+    // Generates v4 uuids by default.
+    std::function<uuid()> generator;
+};
+
+// A pool of pre-generated uuids, kept full by a background thread, for paths that
+// cannot afford the occasional stall of generating ids on demand, e.g. lock contention
+// or seeding the random engine on first use.
+// Ids are kept in a bounded lock-free MPMC ring buffer, thus taking an id in common
+// cases costs only a CAS on the head index.
+// This class is thread-safe.
+class uuid_pool {
+public:
+    explicit uuid_pool(uuid_pool_options opts = {});
+
+    ~uuid_pool();
+
+    uuid_pool(const uuid_pool&) = delete;
+
+    uuid_pool(uuid_pool&&) = delete;
+
+    uuid_pool& operator=(const uuid_pool&) = delete;
+
+    uuid_pool& operator=(uuid_pool&&) = delete;
+
+    // Takes an id from the pool; see `uuid_pool_options::fallback_inline` for behavior
+    // on an empty pool.
+    uuid take();
+
+    // Returns std::nullopt if the pool is empty at the moment.
+    std::optional<uuid> try_take();
+
+    // The value is approximate when other threads are taking ids concurrently.
+    [[nodiscard]] std::size_t available() const noexcept;
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    // Number of ids generated inline because the pool was drained.
+    [[nodiscard]] uint64_t fallback_count() const noexcept {
+        return fallbacks_.load(std::memory_order_relaxed);
+    }
+
+    // Number of refill rounds the background thread has run.
+    [[nodiscard]] uint64_t refill_count() const noexcept {
+        return refills_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct slot {
+        std::atomic<std::size_t> seq;
+        uuid value{k_nil};
+    };
+
+    bool try_push(const uuid& id);
+
+    void fill();
+
+    void notify_if_low();
+
+    void run_refill();
+
+private:
+    std::size_t mask_;
+    std::size_t low_watermark_;
+    std::size_t high_watermark_;
+    bool fallback_inline_;
+    std::function<uuid()> generator_;
+    std::unique_ptr<slot[]> slots_;
+
+    alignas(details::k_cache_line_size) std::atomic<std::size_t> head_{0};
+    alignas(details::k_cache_line_size) std::atomic<std::size_t> tail_{0};
+
+    alignas(details::k_cache_line_size) std::atomic<bool> refill_pending_{false};
+    std::atomic<uint64_t> fallbacks_{0};
+    std::atomic<uint64_t> refills_{0};
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool refill_requested_{false};
+    bool stopped_{false};
+    std::thread refiller_;
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_POOL_H_
@@ -0,0 +1,254 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_search.h"
+
+#include <cstdint>
+
+#include "uuidxx/cpu_features.h"
+
+namespace uuidxx {
+namespace {
+
+static_assert(sizeof(uuid) == 16, "kernels load uuids as pairs of 64-bit lanes");
+
+bool equals(const uuid& lhs, const uuid& rhs) noexcept {
+    const auto& l = lhs.raw_data();
+    const auto& r = rhs.raw_data();
+    return ((l[0] ^ r[0]) | (l[1] ^ r[1])) == 0;
+}
+
+} // namespace
+
+namespace details {
+
+std::size_t find_scalar(const uuid* ids, std::size_t count, const uuid& id) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (equals(ids[i], id)) {
+            return i;
+        }
+    }
+    return count;
+}
+
+std::size_t count_equal_scalar(const uuid* ids, std::size_t count, const uuid& id) noexcept {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        n += equals(ids[i], id) ? 1 : 0;
+    }
+    return n;
+}
+
+} // namespace details
+
+#if UUIDXX_HAS_X86_SIMD
+
+namespace {
+
+// Lane masks have one bit per 64-bit lane; an id matches if both of its lanes do, i.e. a
+// pair of bits at an even position.
+template<typename Mask>
+Mask matched_ids(Mask lanes) noexcept {
+    return lanes & (lanes >> 1) & static_cast<Mask>(UINT64_C(0x5555'5555'5555'5555));
+}
+
+int lowest_bit(uint32_t mask) noexcept {
+    return __builtin_ctz(mask);
+}
+
+UUIDXX_TARGET_AVX2 __m256i broadcast_avx2(const uuid& id) noexcept {
+    return _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(id.raw_data().data())));
+}
+
+UUIDXX_TARGET_AVX2 uint32_t lanes_avx2(const uuid* ids, __m256i key) noexcept {
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids));
+    return static_cast<uint32_t>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, key))));
+}
+
+// Lane masks of 8 ids, from `ids[0]` at bit 0.
+UUIDXX_TARGET_AVX2 uint32_t lanes8_avx2(const uuid* ids, __m256i key) noexcept {
+    return lanes_avx2(ids, key) | (lanes_avx2(ids + 2, key) << 4) |
+           (lanes_avx2(ids + 4, key) << 8) | (lanes_avx2(ids + 6, key) << 12);
+}
+
+UUIDXX_TARGET_AVX512 __m512i broadcast_avx512(const uuid& id) noexcept {
+    // Lanes are set from the last argument.
+    const auto& raw = id.raw_data();
+    return _mm512_set4_epi64(static_cast<int64_t>(raw[1]), static_cast<int64_t>(raw[0]),
+                             static_cast<int64_t>(raw[1]), static_cast<int64_t>(raw[0]));
+}
+
+UUIDXX_TARGET_AVX512 uint32_t lanes_avx512(const uuid* ids, __m512i key) noexcept {
+    const auto v = _mm512_loadu_si512(ids);
+    return _mm512_cmpeq_epi64_mask(v, key);
+}
+
+UUIDXX_TARGET_AVX512 uint32_t lanes16_avx512(const uuid* ids, __m512i key) noexcept {
+    return lanes_avx512(ids, key) | (lanes_avx512(ids + 4, key) << 8) |
+           (lanes_avx512(ids + 8, key) << 16) | (lanes_avx512(ids + 12, key) << 24);
+}
+
+// Up to 3 ids; masked off lanes never match.
+UUIDXX_TARGET_AVX512 uint32_t lanes_tail_avx512(const uuid* ids, std::size_t count,
+                                                __m512i key) noexcept {
+    const auto valid = static_cast<__mmask8>((1U << (count * 2)) - 1);
+    const auto v = _mm512_maskz_loadu_epi64(valid, ids);
+    return _mm512_mask_cmpeq_epi64_mask(valid, v, key);
+}
+
+} // namespace
+
+namespace details {
+
+//
+// AVX2: 2 ids per register, 8 per iteration.
+//
+
+UUIDXX_TARGET_AVX2 std::size_t find_avx2(const uuid* ids, std::size_t count,
+                                         const uuid& id) noexcept {
+    const auto key = broadcast_avx2(id);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        if (auto m = matched_ids(lanes8_avx2(ids + i, key)); m != 0) {
+            return i + static_cast<std::size_t>(lowest_bit(m) / 2);
+        }
+    }
+
+    for (; i + 2 <= count; i += 2) {
+        if (auto m = matched_ids(lanes_avx2(ids + i, key)); m != 0) {
+            return i + static_cast<std::size_t>(lowest_bit(m) / 2);
+        }
+    }
+
+    return i < count && equals(ids[i], id) ? i : count;
+}
+
+UUIDXX_TARGET_AVX2 std::size_t count_equal_avx2(const uuid* ids, std::size_t count,
+                                                const uuid& id) noexcept {
+    const auto key = broadcast_avx2(id);
+    std::size_t n = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        n += static_cast<std::size_t>(__builtin_popcount(matched_ids(lanes8_avx2(ids + i, key))));
+    }
+
+    return n + count_equal_scalar(ids + i, count - i, id);
+}
+
+//
+// AVX-512: 4 ids per register, 16 per iteration; the tail is loaded with a mask.
+//
+
+UUIDXX_TARGET_AVX512 std::size_t find_avx512(const uuid* ids, std::size_t count,
+                                             const uuid& id) noexcept {
+    const auto key = broadcast_avx512(id);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        if (auto m = matched_ids(lanes16_avx512(ids + i, key)); m != 0) {
+            return i + static_cast<std::size_t>(lowest_bit(m) / 2);
+        }
+    }
+
+    for (; i + 4 <= count; i += 4) {
+        if (auto m = matched_ids(lanes_avx512(ids + i, key)); m != 0) {
+            return i + static_cast<std::size_t>(lowest_bit(m) / 2);
+        }
+    }
+
+    if (i < count) {
+        if (auto m = matched_ids(lanes_tail_avx512(ids + i, count - i, key)); m != 0) {
+            return i + static_cast<std::size_t>(lowest_bit(m) / 2);
+        }
+    }
+
+    return count;
+}
+
+UUIDXX_TARGET_AVX512 std::size_t count_equal_avx512(const uuid* ids, std::size_t count,
+                                                    const uuid& id) noexcept {
+    const auto key = broadcast_avx512(id);
+    std::size_t n = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        n += static_cast<std::size_t>(
+                __builtin_popcount(matched_ids(lanes16_avx512(ids + i, key))));
+    }
+
+    for (; i < count; i += 4) {
+        const auto rest = count - i < 4 ? count - i : 4;
+        n += static_cast<std::size_t>(
+                __builtin_popcount(matched_ids(lanes_tail_avx512(ids + i, rest, key))));
+    }
+
+    return n;
+}
+
+} // namespace details
+
+#endif
+
+namespace {
+
+// Ids are scanned in blocks small enough to stay in L1 while all needles are compared.
+constexpr std::size_t k_block_size = 512;
+
+template<typename Find>
+bool any_of_many_blocked(const uuid* ids, std::size_t count, const uuid* needles,
+                         std::size_t needle_count, Find find_fn) noexcept {
+    for (std::size_t first = 0; first < count; first += k_block_size) {
+        const auto n = count - first < k_block_size ? count - first : k_block_size;
+        for (std::size_t j = 0; j < needle_count; ++j) {
+            if (find_fn(ids + first, n, needles[j]) != n) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::size_t find(const uuid* ids, std::size_t count, const uuid& id) noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx512()) {
+        return details::find_avx512(ids, count, id);
+    }
+
+    if (details::cpu_has_avx2()) {
+        return details::find_avx2(ids, count, id);
+    }
+#endif
+    return details::find_scalar(ids, count, id);
+}
+
+std::size_t count_equal(const uuid* ids, std::size_t count, const uuid& id) noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx512()) {
+        return details::count_equal_avx512(ids, count, id);
+    }
+
+    if (details::cpu_has_avx2()) {
+        return details::count_equal_avx2(ids, count, id);
+    }
+#endif
+    return details::count_equal_scalar(ids, count, id);
+}
+
+bool any_of_many(const uuid* ids, std::size_t count, const uuid* needles,
+                 std::size_t needle_count) noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx512()) {
+        return any_of_many_blocked(ids, count, needles, needle_count, details::find_avx512);
+    }
+
+    if (details::cpu_has_avx2()) {
+        return any_of_many_blocked(ids, count, needles, needle_count, details::find_avx2);
+    }
+#endif
+    return any_of_many_blocked(ids, count, needles, needle_count, details::find_scalar);
+}
+
+} // namespace uuidxx
@@ -0,0 +1,61 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_SEARCH_H_
+#define UUIDXX_UUID_SEARCH_H_
+
+#include <cstddef>
+
+#include "uuidxx/cpu_features.h"
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// Linear scans over unsorted uuid arrays, comparing 2 or 4 ids per instruction with AVX2
+// or AVX-512 if available.
+// For up to a few dozen ids, e.g. ACLs checked on every request, they beat hash tables,
+// which pay for hashing and a likely cache miss on each probe; hash tables win beyond 16
+// to 64 ids, depending on the instruction set.
+
+// Position of the first id equal to `id`, or `count` if there are none.
+[[nodiscard]] std::size_t find(const uuid* ids, std::size_t count, const uuid& id) noexcept;
+
+// Number of ids equal to `id`.
+[[nodiscard]] std::size_t count_equal(const uuid* ids, std::size_t count,
+                                      const uuid& id) noexcept;
+
+// True if any of `ids` equals any of `needles`; takes O(count * needle_count), thus meant
+// for a few needles.
+[[nodiscard]] bool any_of_many(const uuid* ids, std::size_t count, const uuid* needles,
+                               std::size_t needle_count) noexcept;
+
+namespace details {
+
+// Kernels picked by the functions above; call SIMD ones only if the cpu supports them.
+
+std::size_t find_scalar(const uuid* ids, std::size_t count, const uuid& id) noexcept;
+
+std::size_t count_equal_scalar(const uuid* ids, std::size_t count, const uuid& id) noexcept;
+
+#if UUIDXX_HAS_X86_SIMD
+
+UUIDXX_TARGET_AVX2 std::size_t find_avx2(const uuid* ids, std::size_t count,
+                                         const uuid& id) noexcept;
+
+UUIDXX_TARGET_AVX2 std::size_t count_equal_avx2(const uuid* ids, std::size_t count,
+                                                const uuid& id) noexcept;
+
+UUIDXX_TARGET_AVX512 std::size_t find_avx512(const uuid* ids, std::size_t count,
+                                             const uuid& id) noexcept;
+
+UUIDXX_TARGET_AVX512 std::size_t count_equal_avx512(const uuid* ids, std::size_t count,
+                                                    const uuid& id) noexcept;
+
+#endif
+
+} // namespace details
+
+} // namespace uuidxx
+
+#endif // UUIDXX_UUID_SEARCH_H_
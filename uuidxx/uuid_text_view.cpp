@@ -0,0 +1,206 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#include "uuidxx/uuid_text_view.h"
+
+#include <cstring>
+
+#include "uuidxx/bit_utils.h"
+#include "uuidxx/cpu_features.h"
+#include "uuidxx/hash_mix.h"
+
+namespace uuidxx {
+namespace {
+
+// Positions of dashes, i.e. 8, 13, 18 and 23, as a bit mask.
+constexpr uint32_t k_dash_bits = (1U << 8) | (1U << 13) | (1U << 18) | (1U << 23);
+
+bool is_hex_tail(const char* text) noexcept {
+    for (std::size_t i = 32; i < uuid_text_view::k_length; ++i) {
+        if (details::hex_value(text[i]) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool validate_scalar(const char* text) noexcept {
+    for (std::size_t i = 0; i < 32; ++i) {
+        if ((k_dash_bits >> i) & 1) {
+            if (text[i] != '-') {
+                return false;
+            }
+        } else if (details::hex_value(text[i]) < 0) {
+            return false;
+        }
+    }
+    return is_hex_tail(text);
+}
+
+void decode_scalar(const char* text, uuid::data& raw) noexcept {
+    raw = {0, 0};
+    std::size_t digits = 0;
+    for (std::size_t i = 0; i < uuid_text_view::k_length; ++i) {
+        if (i < 32 && ((k_dash_bits >> i) & 1)) {
+            continue;
+        }
+        auto& word = raw[digits / 16];
+        word = (word << 4) | static_cast<uint64_t>(details::hex_value(text[i]));
+        ++digits;
+    }
+}
+
+uint64_t load_u64(const char* ptr) noexcept {
+    uint64_t v;  // NOLINT(cppcoreguidelines-init-variables)
+    std::memcpy(&v, ptr, sizeof(v));
+    return v;
+}
+
+uint32_t load_u32(const char* ptr) noexcept {
+    uint32_t v;  // NOLINT(cppcoreguidelines-init-variables)
+    std::memcpy(&v, ptr, sizeof(v));
+    return v;
+}
+
+// Setting 0x20 lowers letters, and leaves digits and dashes intact.
+bool equals_tail(const char* lhs, const char* rhs) noexcept {
+    constexpr uint32_t lower = UINT32_C(0x2020'2020);
+    return (load_u32(lhs + 32) | lower) == (load_u32(rhs + 32) | lower);
+}
+
+bool equals_scalar(const char* lhs, const char* rhs) noexcept {
+    constexpr uint64_t lower = UINT64_C(0x2020'2020'2020'2020);
+    uint64_t diff = 0;
+    for (std::size_t i = 0; i < 32; i += 8) {
+        diff |= (load_u64(lhs + i) | lower) ^ (load_u64(rhs + i) | lower);
+    }
+    return diff == 0 && equals_tail(lhs, rhs);
+}
+
+#if UUIDXX_HAS_X86_SIMD
+
+UUIDXX_TARGET_AVX2 bool validate_avx2(const char* text) noexcept {
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text));
+    const auto lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+
+    // Bytes beyond 0x7f are negative, and fail both ranges.
+    const auto digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                                        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    const auto alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                        _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+    const auto dash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('-'));
+
+    const auto hex_bits =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(digit, alpha)));
+    const auto dash_bits = static_cast<uint32_t>(_mm256_movemask_epi8(dash));
+    return dash_bits == k_dash_bits && (hex_bits | k_dash_bits) == UINT32_MAX &&
+           is_hex_tail(text);
+}
+
+UUIDXX_TARGET_AVX2 __m128i to_nibbles(__m128i chars) noexcept {
+    // Letters have 0x40 set, and their low nibbles are 1 to 6.
+    const auto alpha = _mm_cmpeq_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x40)),
+                                      _mm_set1_epi8(0x40));
+    return _mm_add_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x0f)),
+                        _mm_and_si128(alpha, _mm_set1_epi8(9)));
+}
+
+UUIDXX_TARGET_AVX2 void decode_avx2(const char* text, uuid::data& raw) noexcept {
+    constexpr char z = static_cast<char>(0x80);
+    const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 16));
+    const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 20));
+
+    // Gathers 16 digits of each half, skipping dashes; `z` zeros the byte.
+    const auto hi_from_a = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, z, z);
+    const auto hi_from_b = _mm_setr_epi8(z, z, z, z, z, z, z, z, z, z, z, z, z, z, 0, 1);
+    const auto lo_from_b = _mm_setr_epi8(3, 4, 5, 6, z, z, z, z, z, z, z, z, z, z, z, z);
+    const auto lo_from_c = _mm_setr_epi8(z, z, z, z, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const auto hi_chars = _mm_or_si128(_mm_shuffle_epi8(a, hi_from_a),
+                                       _mm_shuffle_epi8(b, hi_from_b));
+    const auto lo_chars = _mm_or_si128(_mm_shuffle_epi8(b, lo_from_b),
+                                       _mm_shuffle_epi8(c, lo_from_c));
+
+    // Pairs of nibbles into bytes, i.e. hi * 16 + lo.
+    const auto weights = _mm_set1_epi16(0x0110);
+    const auto bytes = _mm_packus_epi16(_mm_maddubs_epi16(to_nibbles(hi_chars), weights),
+                                        _mm_maddubs_epi16(to_nibbles(lo_chars), weights));
+
+    // Big-endian to native words.
+    const auto words = _mm_shuffle_epi8(
+            bytes, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(raw.data()), words);
+}
+
+UUIDXX_TARGET_AVX2 bool equals_avx2(const char* lhs, const char* rhs) noexcept {
+    const auto lower = _mm256_set1_epi8(0x20);
+    const auto l = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)),
+                                   lower);
+    const auto r = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)),
+                                   lower);
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r)) == -1 && equals_tail(lhs, rhs);
+}
+
+#endif
+
+void decode(const char* text, uuid::data& raw) noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        decode_avx2(text, raw);
+        return;
+    }
+#endif
+    decode_scalar(text, raw);
+}
+
+} // namespace
+
+// static
+std::optional<uuid_text_view> uuid_text_view::make(std::string_view text) noexcept {
+    if (text.size() == k_length + 2) {
+        if (text.front() != '{' || text.back() != '}') {
+            return std::nullopt;
+        }
+        text = text.substr(1, k_length);
+    }
+
+    if (text.size() != k_length) {
+        return std::nullopt;
+    }
+
+#if UUIDXX_HAS_X86_SIMD
+    const bool valid = details::cpu_has_avx2() ? validate_avx2(text.data())
+                                               : validate_scalar(text.data());
+#else
+    const bool valid = validate_scalar(text.data());
+#endif
+    if (!valid) {
+        return std::nullopt;
+    }
+
+    return uuid_text_view(text.data());
+}
+
+uuid uuid_text_view::to_uuid() const noexcept {
+    uuid::data raw;
+    decode(text_, raw);
+    return uuid(raw, details::gen_from_raw_data);
+}
+
+std::size_t uuid_text_view::hash() const noexcept {
+    uuid::data raw;
+    decode(text_, raw);
+    return static_cast<std::size_t>(details::mix128(raw[0], raw[1]));
+}
+
+bool uuid_text_view::equals(const uuid_text_view& other) const noexcept {
+#if UUIDXX_HAS_X86_SIMD
+    if (details::cpu_has_avx2()) {
+        return equals_avx2(text_, other.text_);
+    }
+#endif
+    return equals_scalar(text_, other.text_);
+}
+
+} // namespace uuidxx
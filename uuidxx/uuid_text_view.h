@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_UUID_TEXT_VIEW_H_
+#define UUIDXX_UUID_TEXT_VIEW_H_
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// A non-owning view of a canonical uuid string, which is validated once on creation, and
+// compared and hashed without being decoded into a `uuid`.
+// Comparison is case-insensitive, and hash values equal those of `std::hash<uuid>` of the
+// decoded uuids; thus views and uuids can be mixed in hash joins.
+// The viewed string must outlive the view.
+class uuid_text_view {
+public:
+    static constexpr std::size_t k_length = 36;
+
+    // Accepts the same formats as `make_from()`, i.e. canonical strings, optionally
+    // enclosed in braces, in either case.
+    // Returns std::nullopt if `text` is not of the formats.
+    static std::optional<uuid_text_view> make(std::string_view text) noexcept;
+
+    // Without braces.
+    [[nodiscard]] std::string_view text() const noexcept {
+        return std::string_view(text_, k_length);
+    }
+
+    [[nodiscard]] uuid to_uuid() const noexcept;
+
+    [[nodiscard]] std::size_t hash() const noexcept;
+
+    [[nodiscard]] bool equals(const uuid_text_view& other) const noexcept;
+
+private:
+    explicit uuid_text_view(const char* text) noexcept
+        : text_(text) {}
+
+private:
+    const char* text_;
+};
+
+inline bool operator==(const uuid_text_view& lhs, const uuid_text_view& rhs) noexcept {
+    return lhs.equals(rhs);
+}
+
+inline bool operator!=(const uuid_text_view& lhs, const uuid_text_view& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator==(const uuid_text_view& lhs, const uuid& rhs) noexcept {
+    return lhs.to_uuid() == rhs;
+}
+
+inline bool operator==(const uuid& lhs, const uuid_text_view& rhs) noexcept {
+    return rhs == lhs;
+}
+
+inline bool operator!=(const uuid_text_view& lhs, const uuid& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator!=(const uuid& lhs, const uuid_text_view& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace uuidxx
+
+namespace std {
+
+template<>
+struct hash<uuidxx::uuid_text_view> {
+    size_t operator()(const uuidxx::uuid_text_view& view) const noexcept {
+        return view.hash();
+    }
+};
+
+} // namespace std
+
+#endif // UUIDXX_UUID_TEXT_VIEW_H_
@@ -5,14 +5,33 @@
 #ifndef UUIDXX_UUIDXX_H_
 #define UUIDXX_UUIDXX_H_
 
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+
 #include "uuidxx/dce_host_identifier.h"
+#include "uuidxx/endian_utils.h"
 #include "uuidxx/rand_generator.h"
+#include "uuidxx/stats.h"
 #include "uuidxx/uuid.h"
 
 namespace uuidxx {
 
+// Pays one-time costs, i.e. seeding the random engine, initializing clock sequence and
+// resolving node id, which otherwise land on the first generation.
+// Call it on startup, after `set_node_options()` if any, before serving traffic.
+inline void warm_up() {
+    details::global_random_generator::instance();
+    clock_sequence::instance();
+
+    node_id id;
+    read_mac_addr_as_node_id(id);
+}
+
 template<typename NodeFetcher = mac_addr_reader_t>
 uuid make_v1(NodeFetcher&& fetcher = read_mac_addr_as_node_id) {
+    const details::scoped_generation_stat stat(stat_counter::generated_v1);
     return uuid(std::forward<NodeFetcher>(fetcher), details::gen_v1);
 }
 
@@ -22,25 +41,30 @@ uuid make_v1(NodeFetcher&& fetcher = read_mac_addr_as_node_id) {
 // lack of specific explanatory demo code makes this implementation failed to meet
 // the spec.
 inline uuid make_v2(host_id host) {
+    const details::scoped_generation_stat stat(stat_counter::generated_v2);
     return uuid(host, details::gen_v2);
 }
 
 inline uuid make_v3(const uuid& ns, std::string_view name) {
+    const details::scoped_generation_stat stat(stat_counter::generated_v3);
     return uuid(ns, name, details::gen_v3);
 }
 
 template<typename RandGen = default_rand_gen_t>
 uuid make_v4(RandGen&& gen = default_rand_gen) {
+    const details::scoped_generation_stat stat(stat_counter::generated_v4);
     return uuid(std::forward<RandGen>(gen), details::gen_v4);
 }
 
 inline uuid make_v5(const uuid& ns, std::string_view name) {
+    const details::scoped_generation_stat stat(stat_counter::generated_v5);
     return uuid(ns, name, details::gen_v5);
 }
 
 // Only format like `xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx` and
 // `{xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx}` are supported.
-// Would throw `bad_uuid_string` if `src` is not a valid uuid string.
+// Would throw `bad_uuid_string` if `src` is not a valid uuid string; see the overload
+// taking `std::error_code` for untrusted input.
 inline uuid make_from(std::string_view src) {
     return uuid(src, details::gen_from_str);
 }
@@ -49,6 +73,11 @@ constexpr uuid make_from(const data_bytes& bytes) {
     return uuid(bytes, details::gen_from_data_bytes);
 }
 
+// `raw` must be obtained from `uuid::raw_data()`.
+constexpr uuid make_from_raw_data(const uuid::data& raw) {
+    return uuid(raw, details::gen_from_raw_data);
+}
+
 const constexpr auto k_nil = make_from(data_bytes{});
 
 // Predefined constants name space ids defined in RFC 4122
@@ -69,6 +98,58 @@ const constexpr auto k_namespace_oid = make_from(
 const constexpr auto k_namespace_x500 = make_from(
     data_bytes{0x6ba7b814, 0x9dad, 0x11d1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8});
 
+// Non-throwing and non-allocating overloads, for untrusted input and builds without
+// exceptions. On failure, `ec` is set and `k_nil` is returned; otherwise `ec` is cleared.
+
+inline uuid make_from(std::string_view src, std::error_code& ec) noexcept {
+    uuid::data raw{0, 0};
+    if (auto err = details::parse_uuid_str(src, raw); err != uuid_errc{}) {
+        ec = err;
+        return k_nil;
+    }
+
+    ec.clear();
+    return make_from_raw_data(raw);
+}
+
+// `bytes` are the 16 bytes of a uuid in network byte order, as in RFC 4122.
+inline uuid make_from_bytes(const void* bytes, std::size_t size, std::error_code& ec) noexcept {
+    if (size != sizeof(uuid::data)) {
+        ec = uuid_errc::invalid_length;
+        return k_nil;
+    }
+
+    uuid::data raw;
+    std::memcpy(raw.data(), bytes, sizeof(raw));
+    ec.clear();
+    return make_from_raw_data({byteswap(raw[0]), byteswap(raw[1])});
+}
+
+// Names are hashed as a whole, thus bound their size if they come from untrusted input.
+inline constexpr std::size_t k_default_max_name_size = 8192;
+
+inline uuid make_v3(const uuid& ns, std::string_view name, std::error_code& ec,
+                    std::size_t max_name_size = k_default_max_name_size) noexcept {
+    if (name.size() > max_name_size) {
+        ec = uuid_errc::name_too_long;
+        return k_nil;
+    }
+
+    ec.clear();
+    return make_v3(ns, name);
+}
+
+inline uuid make_v5(const uuid& ns, std::string_view name, std::error_code& ec,
+                    std::size_t max_name_size = k_default_max_name_size) noexcept {
+    if (name.size() > max_name_size) {
+        ec = uuid_errc::name_too_long;
+        return k_nil;
+    }
+
+    ec.clear();
+    return make_v5(ns, name);
+}
+
 } // namespace uuidxx
 
 #endif // UUIDXX_UUIDXX_H_
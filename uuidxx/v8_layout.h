@@ -0,0 +1,199 @@
+// Copyright (c) 2021 Kingsley Chen <kingsamchen@gmail.com>
+// This file is subject to the terms of license that can be
+// found in the LICENSE file.
+
+#ifndef UUIDXX_V8_LAYOUT_H_
+#define UUIDXX_V8_LAYOUT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "uuidxx/uuid.h"
+
+namespace uuidxx {
+
+// A field of v8 uuids, occupying bits [Offset, Offset + Width) of the 122 custom bits.
+// Custom bits are numbered from the most significant one, as in canonical strings, with
+// version and variant bits skipped; e.g. bit 48 is right after the version.
+// Derive from it to name a field:
+//   struct region : v8_field<0, 8> {};
+template<std::size_t Offset, std::size_t Width>
+struct v8_field {
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t width = Width;
+};
+
+namespace details {
+
+inline constexpr std::size_t k_v8_custom_bits = 122;
+
+// Custom bits [0, 48) are before the version, [48, 60) between the version and the
+// variant, and [60, 122) after the variant.
+inline constexpr std::size_t k_v8_version_at = 48;
+inline constexpr std::size_t k_v8_variant_at = 60;
+
+constexpr std::size_t v8_physical_bit(std::size_t logical) noexcept {
+    if (logical < k_v8_version_at) {
+        return logical;
+    }
+
+    return logical < k_v8_variant_at ? logical + 4 : logical + 6;
+}
+
+// A run of bits that is contiguous in both the field value and one word of `uuid::data`.
+struct v8_segment {
+    std::size_t word;
+    std::size_t value_shift;
+    std::size_t word_shift;
+    uint64_t mask;
+};
+
+struct v8_segments {
+    std::array<v8_segment, 3> items;
+    std::size_t count;
+};
+
+constexpr v8_segments make_v8_segments(std::size_t offset, std::size_t width) noexcept {
+    v8_segments segs{};
+    const std::size_t end = offset + width;
+    const std::size_t cuts[] = {k_v8_version_at, k_v8_variant_at, end};
+    std::size_t first = offset;
+    for (auto cut : cuts) {
+        if (cut <= first || first >= end) {
+            continue;
+        }
+
+        const std::size_t last = cut < end ? cut : end;
+        const std::size_t len = last - first;
+        const std::size_t phys_last = v8_physical_bit(last - 1);
+        segs.items[segs.count++] = v8_segment{phys_last / 64, end - last, 63 - phys_last % 64,
+                                              len == 64 ? ~UINT64_C(0) : (UINT64_C(1) << len) - 1};
+        first = last;
+    }
+
+    return segs;
+}
+
+template<typename... Fields>
+constexpr bool v8_fields_disjoint() noexcept {
+    constexpr std::size_t n = sizeof...(Fields);
+    if constexpr (n == 0) {
+        return true;
+    } else {
+        constexpr std::size_t offsets[n]{Fields::offset...};
+        constexpr std::size_t ends[n]{(Fields::offset + Fields::width)...};
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = i + 1; j < n; ++j) {
+                if (offsets[i] < ends[j] && offsets[j] < ends[i]) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+template<typename Field>
+struct is_v8_field {
+    template<std::size_t Offset, std::size_t Width>
+    static std::true_type test(const v8_field<Offset, Width>*);
+
+    static std::false_type test(...);
+
+    static constexpr bool value = decltype(test(static_cast<const Field*>(nullptr)))::value;
+};
+
+} // namespace details
+
+// True if all fields are of `v8_field`, 1 to 64 bits wide, within the custom bits, and
+// don't overlap each other.
+template<typename... Fields>
+inline constexpr bool is_valid_v8_layout =
+        sizeof...(Fields) > 0 && (details::is_v8_field<Fields>::value && ...) &&
+        ((Fields::width >= 1 && Fields::width <= 64 &&
+          Fields::offset + Fields::width <= details::k_v8_custom_bits) &&
+         ...) &&
+        details::v8_fields_disjoint<Fields...>();
+
+// Describes a custom layout of v8 uuids defined by RFC 9562, at compile time.
+// Packing and unpacking a field compiles down to a few shifts and masks per word it
+// spans, with no branches; version and variant bits are handled automatically.
+// Bits not covered by any field are zeros.
+template<typename... Fields>
+class v8_layout {
+public:
+    static_assert(sizeof...(Fields) > 0, "a layout needs at least one field");
+    static_assert((details::is_v8_field<Fields>::value && ...),
+                  "fields must be derived from v8_field");
+    static_assert(((Fields::width >= 1 && Fields::width <= 64) && ...),
+                  "fields must be 1 to 64 bits wide");
+    static_assert(((Fields::offset + Fields::width <= details::k_v8_custom_bits) && ...),
+                  "fields must be within the 122 custom bits");
+    static_assert(details::v8_fields_disjoint<Fields...>(), "fields must not overlap");
+
+    static constexpr std::size_t field_count = sizeof...(Fields);
+
+    // Values in order of `Fields`; bits beyond widths are ignored.
+    using values = std::array<uint64_t, field_count>;
+
+    static constexpr uuid encode(const values& vals) noexcept {
+        uuid::data raw{UINT64_C(0x8000), UINT64_C(0x8000'0000'0000'0000)};
+        std::size_t i = 0;
+        (pack<Fields>(raw, vals[i++]), ...);
+        return uuid(raw, details::gen_from_raw_data);
+    }
+
+    static constexpr values decode(const uuid& id) noexcept {
+        return values{get<Fields>(id)...};
+    }
+
+    template<typename Field>
+    static constexpr uint64_t get(const uuid& id) noexcept {
+        static_assert((std::is_same_v<Field, Fields> || ...), "field not in the layout");
+        constexpr auto segs = details::make_v8_segments(Field::offset, Field::width);
+        const auto& raw = id.raw_data();
+        uint64_t value = 0;
+        for (std::size_t i = 0; i < segs.count; ++i) {
+            const auto& seg = segs.items[i];
+            value |= ((raw[seg.word] >> seg.word_shift) & seg.mask) << seg.value_shift;
+        }
+        return value;
+    }
+
+    // Replaces the field of `id`, which should be of the layout.
+    template<typename Field>
+    static constexpr uuid set(const uuid& id, uint64_t value) noexcept {
+        static_assert((std::is_same_v<Field, Fields> || ...), "field not in the layout");
+        constexpr auto segs = details::make_v8_segments(Field::offset, Field::width);
+        auto raw = id.raw_data();
+        for (std::size_t i = 0; i < segs.count; ++i) {
+            const auto& seg = segs.items[i];
+            raw[seg.word] &= ~(seg.mask << seg.word_shift);
+        }
+        pack<Field>(raw, value);
+        return uuid(raw, details::gen_from_raw_data);
+    }
+
+    // True if `id` is a v8 uuid of RFC variant; the layout itself is not verifiable.
+    static constexpr bool matches(const uuid& id) noexcept {
+        const auto& raw = id.raw_data();
+        return ((raw[0] >> 12) & 0x0f) == version::v8 && (raw[1] >> 62) == 0b10;
+    }
+
+private:
+    template<typename Field>
+    static constexpr void pack(uuid::data& raw, uint64_t value) noexcept {
+        constexpr auto segs = details::make_v8_segments(Field::offset, Field::width);
+        for (std::size_t i = 0; i < segs.count; ++i) {
+            const auto& seg = segs.items[i];
+            raw[seg.word] |= ((value >> seg.value_shift) & seg.mask) << seg.word_shift;
+        }
+    }
+};
+
+} // namespace uuidxx
+
+#endif // UUIDXX_V8_LAYOUT_H_